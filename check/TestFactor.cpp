@@ -2,6 +2,7 @@
 #include "Highs.h"
 #include "catch.hpp"
 #include "util/HFactor.h"
+#include "util/HighsSimd.h"
 
 const bool dev_run = false;
 
@@ -179,6 +180,362 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
 }
 
+TEST_CASE("Factor-simd-kernels", "[highs_test_factor]") {
+  // The vectorised kernels must give the same results as the scalar
+  // kernels, including the order of any new indices
+  const HighsSimdLevel max_level = highsSimdMaxLevel();
+  if (dev_run)
+    printf("Maximum SIMD level is %s\n",
+           highsSimdLevelToString(max_level).c_str());
+  const HighsInt dim = 100;
+  HighsRandom random;
+  std::vector<double> array0(dim);
+  std::vector<double> from_array(dim);
+  std::vector<HighsInt> permutation(dim);
+  for (HighsInt i = 0; i < dim; i++) permutation[i] = i;
+  for (HighsInt count = 0; count <= 40; count++) {
+    // Form distinct indices, values and an array with zero, tiny and
+    // other values
+    random.shuffle(permutation.data(), dim);
+    std::vector<HighsInt> index(permutation.begin(),
+                                permutation.begin() + count);
+    std::vector<double> value(count);
+    for (HighsInt k = 0; k < count; k++) value[k] = random.fraction() - 0.5;
+    for (HighsInt i = 0; i < dim; i++) {
+      const double x = random.fraction();
+      array0[i] = x < 0.3 ? 0 : x < 0.4 ? 1e-15 : x - 0.5;
+      from_array[i] = random.fraction() - 0.5;
+    }
+    // Make some results tiny
+    const double multiplier = 0.5;
+    if (count > 2) array0[index[2]] = multiplier * value[2];
+
+    std::vector<double> scalar_array;
+    std::vector<HighsInt> scalar_index;
+    HighsInt scalar_count = 0;
+    double scalar_dot = 0;
+    double scalar_sum = 0;
+    for (HighsInt level = 0; level <= (HighsInt)max_level; level++) {
+      const HighsSimdLevel simd_level = static_cast<HighsSimdLevel>(level);
+      std::vector<double> array = array0;
+      std::vector<HighsInt> array_index(2 * dim);
+      HighsInt array_count = 0;
+      highsSimdSubtractMultiple(simd_level, array.data(), multiplier,
+                                index.data(), value.data(), count);
+      highsSimdSubtractMultipleTrack(simd_level, array.data(),
+                                     array_index.data(), array_count,
+                                     multiplier, index.data(), value.data(),
+                                     count);
+      highsSimdAddMultipleTrack(simd_level, array.data(), array_index.data(),
+                                array_count, multiplier, from_array.data(),
+                                index.data(), count);
+      const double dot = highsSimdSubtractDot(
+          simd_level, 1.0, array.data(), index.data(), value.data(), count);
+      const double sum =
+          highsSimdSumSquares(simd_level, array.data(), index.data(), count);
+      // Record the new indices, followed by those remaining after
+      // removing tiny values
+      array_index.resize(array_count);
+      std::vector<HighsInt> tight_index = index;
+      tight_index.resize(
+          highsSimdTight(simd_level, array.data(), tight_index.data(), count));
+      array_index.insert(array_index.end(), tight_index.begin(),
+                         tight_index.end());
+      highsSimdZeroTiny(simd_level, array.data(), dim);
+      if (level == 0) {
+        scalar_array = array;
+        scalar_index = array_index;
+        scalar_count = array_count;
+        scalar_dot = dot;
+        scalar_sum = sum;
+      } else {
+        REQUIRE(array == scalar_array);
+        REQUIRE(array_index == scalar_index);
+        REQUIRE(array_count == scalar_count);
+        REQUIRE(dot == scalar_dot);
+        REQUIRE(sum == scalar_sum);
+      }
+    }
+  }
+}
+
+TEST_CASE("Factor-simd-solve", "[highs_test_factor]") {
+  // Since the vectorised kernels give the same results as the scalar
+  // kernels, so should the simplex solver
+  const HighsSimdLevel max_level = highsSimdMaxLevel();
+  std::vector<std::string> models = {"adlittle", "25fv47"};
+  for (const std::string& model : models) {
+    const std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    HighsInt scalar_iteration_count = 0;
+    double scalar_objective = 0;
+    for (HighsInt level = 0; level <= (HighsInt)max_level; level++) {
+      highsSimdSetLevel(static_cast<HighsSimdLevel>(level));
+      Highs highs;
+      highs.setOptionValue("output_flag", dev_run);
+      highs.setOptionValue("presolve", kHighsOffString);
+      REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      const HighsInfo& info = highs.getInfo();
+      if (level == 0) {
+        scalar_iteration_count = info.simplex_iteration_count;
+        scalar_objective = info.objective_function_value;
+      } else {
+        REQUIRE(info.simplex_iteration_count == scalar_iteration_count);
+        REQUIRE(info.objective_function_value == scalar_objective);
+      }
+    }
+  }
+  highsSimdSetLevel(max_level);
+}
+
+TEST_CASE("Factor-dense-kernel", "[highs_test_factor]") {
+  // Factor a basis with a dense kernel using sparse and dense LU, and
+  // check the accuracy of FTRAN and BTRAN
+  const HighsInt dim = 150;
+  const HighsInt num_logical = 20;
+  HighsRandom random;
+  HighsSparseMatrix a_matrix;
+  a_matrix.num_col_ = dim;
+  a_matrix.num_row_ = dim;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      if (random.fraction() < 0.6) {
+        a_matrix.index_.push_back(iRow);
+        a_matrix.value_.push_back(random.fraction() - 0.5);
+      }
+    }
+    a_matrix.start_.push_back(a_matrix.index_.size());
+  }
+  // Kernel settings for sparse LU, dense LU from the start, and dense
+  // LU once sufficiently dense
+  std::vector<std::pair<HighsInt, double>> kernel_dense = {
+      {kHighsIInf, 0.0}, {1, 0.0}, {50, 0.6}};
+  for (HighsInt duplicate = 0; duplicate < 2; duplicate++) {
+    // Second time round, make the last structural in the basis a
+    // duplicate of the first, so the basis has rank deficiency 1
+    std::vector<HighsInt> basic_index0;
+    for (HighsInt iRow = 0; iRow < num_logical; iRow++)
+      basic_index0.push_back(dim + iRow);
+    for (HighsInt iCol = 0; iCol < dim - num_logical; iCol++)
+      basic_index0.push_back(iCol);
+    if (duplicate) basic_index0[dim - 1] = num_logical;
+    for (const auto& setting : kernel_dense) {
+      std::vector<HighsInt> basic_index = basic_index0;
+      HFactor dense_factor;
+      dense_factor.setup(a_matrix, basic_index);
+      dense_factor.setKernelDense(setting.first, setting.second);
+      const HighsInt rank_deficiency = dense_factor.build();
+      REQUIRE(rank_deficiency == duplicate);
+      // Form B, and check that Bx = b and B^Ty = c
+      std::vector<double> b(dim, 0);
+      std::vector<double> c(dim);
+      HVector x;
+      HVector y;
+      x.setup(dim);
+      y.setup(dim);
+      x.clear();
+      y.clear();
+      for (HighsInt iRow = 0; iRow < dim; iRow++) {
+        x.array[iRow] = random.fraction() - 0.5;
+        y.array[iRow] = random.fraction() - 0.5;
+        x.index[x.count++] = iRow;
+        y.index[y.count++] = iRow;
+      }
+      b = x.array;
+      c = y.array;
+      dense_factor.ftranCall(x, 1);
+      dense_factor.btranCall(y, 1);
+      double ftran_error = 0;
+      double btran_error = 0;
+      std::vector<double> residual = b;
+      for (HighsInt iRow = 0; iRow < dim; iRow++) {
+        const HighsInt iVar = basic_index[iRow];
+        double y_dot_column = 0;
+        if (iVar < dim) {
+          for (HighsInt iEl = a_matrix.start_[iVar];
+               iEl < a_matrix.start_[iVar + 1]; iEl++) {
+            residual[a_matrix.index_[iEl]] -=
+                a_matrix.value_[iEl] * x.array[iRow];
+            y_dot_column += a_matrix.value_[iEl] * y.array[a_matrix.index_[iEl]];
+          }
+        } else {
+          residual[iVar - dim] -= x.array[iRow];
+          y_dot_column = y.array[iVar - dim];
+        }
+        btran_error = std::max(std::fabs(y_dot_column - c[iRow]), btran_error);
+      }
+      for (HighsInt iRow = 0; iRow < dim; iRow++)
+        ftran_error = std::max(std::fabs(residual[iRow]), ftran_error);
+      if (dev_run)
+        printf(
+            "Kernel dense (%d, %g) rank deficiency %d: FTRAN error %g; BTRAN "
+            "error %g\n",
+            (int)setting.first, setting.second, (int)rank_deficiency,
+            ftran_error, btran_error);
+      REQUIRE(ftran_error < 1e-8);
+      REQUIRE(btran_error < 1e-8);
+    }
+  }
+}
+
+TEST_CASE("Factor-kernel-blocks", "[highs_test_factor]") {
+  // Factor a basis whose kernel has independent blocks, and check the
+  // accuracy of FTRAN and BTRAN
+  const HighsInt num_block = 3;
+  const HighsInt block_dim = 300;
+  const HighsInt dim = num_block * block_dim;
+  HighsRandom random;
+  HighsSparseMatrix a_matrix;
+  a_matrix.num_col_ = dim;
+  a_matrix.num_row_ = dim;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    const HighsInt block_start = (iCol / block_dim) * block_dim;
+    for (HighsInt iRow = block_start; iRow < block_start + block_dim;
+         iRow++) {
+      if (iRow == iCol || random.fraction() < 0.02) {
+        a_matrix.index_.push_back(iRow);
+        a_matrix.value_.push_back(random.fraction() + (iRow == iCol));
+      }
+    }
+    a_matrix.start_.push_back(a_matrix.index_.size());
+  }
+  for (HighsInt duplicate = 0; duplicate < 2; duplicate++) {
+    // Second time round, duplicate a column in the second block, so
+    // the basis has rank deficiency 1
+    std::vector<HighsInt> basic_index(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_index[iCol] = iCol;
+    if (duplicate) basic_index[block_dim + 1] = block_dim;
+    HFactor block_factor;
+    block_factor.setup(a_matrix, basic_index);
+    const HighsInt rank_deficiency = block_factor.build();
+    REQUIRE(rank_deficiency == duplicate);
+    HVector x;
+    HVector y;
+    x.setup(dim);
+    y.setup(dim);
+    x.clear();
+    y.clear();
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      x.array[iRow] = random.fraction() - 0.5;
+      y.array[iRow] = random.fraction() - 0.5;
+      x.index[x.count++] = iRow;
+      y.index[y.count++] = iRow;
+    }
+    std::vector<double> residual = x.array;
+    const std::vector<double> c = y.array;
+    block_factor.ftranCall(x, 1);
+    block_factor.btranCall(y, 1);
+    double ftran_error = 0;
+    double btran_error = 0;
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      const HighsInt iVar = basic_index[iRow];
+      double y_dot_column = 0;
+      if (iVar < dim) {
+        for (HighsInt iEl = a_matrix.start_[iVar];
+             iEl < a_matrix.start_[iVar + 1]; iEl++) {
+          residual[a_matrix.index_[iEl]] -=
+              a_matrix.value_[iEl] * x.array[iRow];
+          y_dot_column += a_matrix.value_[iEl] * y.array[a_matrix.index_[iEl]];
+        }
+      } else {
+        residual[iVar - dim] -= x.array[iRow];
+        y_dot_column = y.array[iVar - dim];
+      }
+      btran_error = std::max(std::fabs(y_dot_column - c[iRow]), btran_error);
+    }
+    for (HighsInt iRow = 0; iRow < dim; iRow++)
+      ftran_error = std::max(std::fabs(residual[iRow]), ftran_error);
+    if (dev_run)
+      printf("Rank deficiency %d: FTRAN error %g; BTRAN error %g\n",
+             (int)rank_deficiency, ftran_error, btran_error);
+    REQUIRE(ftran_error < 1e-8);
+    REQUIRE(btran_error < 1e-8);
+  }
+}
+
+TEST_CASE("Factor-btf", "[highs_test_factor]") {
+  // Factor a basis matrix that has block triangular form, with its rows
+  // and columns permuted, and check the accuracy of FTRAN and BTRAN
+  // with dense and sparse RHS
+  const HighsInt num_block = 40;
+  const HighsInt block_dim = 10;
+  const HighsInt dim = num_block * block_dim;
+  HighsRandom random;
+  std::vector<HighsInt> row_permutation(dim);
+  for (HighsInt iRow = 0; iRow < dim; iRow++) row_permutation[iRow] = iRow;
+  for (HighsInt iRow = dim - 1; iRow > 0; iRow--)
+    std::swap(row_permutation[iRow],
+              row_permutation[random.integer(iRow + 1)]);
+  HighsSparseMatrix a_matrix;
+  a_matrix.num_col_ = dim;
+  a_matrix.num_row_ = dim;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    // Each diagonal block has a diagonal and a cycle of entries, so is
+    // irreducible, and the columns have random entries in the rows of
+    // earlier blocks
+    const HighsInt block_start = (iCol / block_dim) * block_dim;
+    const HighsInt cycle_row =
+        block_start + (iCol - block_start + 1) % block_dim;
+    for (HighsInt iRow = 0; iRow < block_start + block_dim; iRow++) {
+      if (iRow == iCol || iRow == cycle_row ||
+          random.fraction() < (iRow < block_start ? 0.01 : 0.2)) {
+        a_matrix.index_.push_back(row_permutation[iRow]);
+        a_matrix.value_.push_back(random.fraction() + 2 * (iRow == iCol));
+      }
+    }
+    a_matrix.start_.push_back(a_matrix.index_.size());
+  }
+  std::vector<HighsInt> basic_index(dim);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_index[iCol] = iCol;
+  for (HighsInt iCol = dim - 1; iCol > 0; iCol--)
+    std::swap(basic_index[iCol], basic_index[random.integer(iCol + 1)]);
+  HFactor btf_factor;
+  btf_factor.setup(a_matrix, basic_index);
+  REQUIRE(btf_factor.build() == 0);
+  HVector x;
+  HVector y;
+  x.setup(dim);
+  y.setup(dim);
+  for (HighsInt rhs_count = dim; rhs_count > 0; rhs_count /= 4) {
+    x.clear();
+    y.clear();
+    for (HighsInt k = 0; k < rhs_count; k++) {
+      const HighsInt iRow = rhs_count == dim ? k : random.integer(dim);
+      if (x.array[iRow]) continue;
+      x.array[iRow] = random.fraction() + 0.5;
+      y.array[iRow] = random.fraction() + 0.5;
+      x.index[x.count++] = iRow;
+      y.index[y.count++] = iRow;
+    }
+    std::vector<double> residual = x.array;
+    const std::vector<double> c = y.array;
+    // Use an expected density of 1 so that the solves aren't
+    // hyper-sparse
+    btf_factor.ftranCall(x, 1);
+    btf_factor.btranCall(y, 1);
+    double ftran_error = 0;
+    double btran_error = 0;
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      const HighsInt iVar = basic_index[iRow];
+      double y_dot_column = 0;
+      for (HighsInt iEl = a_matrix.start_[iVar];
+           iEl < a_matrix.start_[iVar + 1]; iEl++) {
+        residual[a_matrix.index_[iEl]] -= a_matrix.value_[iEl] * x.array[iRow];
+        y_dot_column += a_matrix.value_[iEl] * y.array[a_matrix.index_[iEl]];
+      }
+      btran_error = std::max(std::fabs(y_dot_column - c[iRow]), btran_error);
+    }
+    for (HighsInt iRow = 0; iRow < dim; iRow++)
+      ftran_error = std::max(std::fabs(residual[iRow]), ftran_error);
+    if (dev_run)
+      printf("RHS count %d: FTRAN error %g; BTRAN error %g\n", (int)rhs_count,
+             ftran_error, btran_error);
+    REQUIRE(ftran_error < 1e-8);
+    REQUIRE(btran_error < 1e-8);
+  }
+}
+
 HighsInt rowOut(const HighsInt variable_out) {
   for (HighsInt iRow = 0; iRow < num_row; iRow++)
     if (basic_set[iRow] == variable_out) return iRow;
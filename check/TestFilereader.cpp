@@ -1,4 +1,5 @@
 #include <cstdio>
+#include <fstream>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
@@ -200,6 +201,101 @@ TEST_CASE("filereader-free-format-parser-lp", "[highs_filereader]") {
   REQUIRE(are_the_same);
 }
 
+TEST_CASE("filereader-free-format-parser-parallel", "[highs_filereader]") {
+  // Models with integrality markers, and ones large enough for the
+  // COLUMNS section to be parsed in several chunks
+  const std::vector<std::string> model_list = {
+      "adlittle", "25fv47", "80bau3b", "greenbea", "p0548", "bell5", "qjh"};
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (const std::string& model : model_list) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    highs.setOptionValue("mps_parser_parallel", false);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsModel model_serial = highs.getModel();
+
+    highs.setOptionValue("mps_parser_parallel", true);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.getModel() == model_serial);
+  }
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/no_such_file.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+}
+
+TEST_CASE("filereader-hbm-round-trip", "[highs_filereader]") {
+  // An LP with names, a MIP and a QP
+  const std::vector<std::string> model_list = {"adlittle", "p0548", "qjh"};
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (const std::string& model : model_list) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsModel model_mps = highs.getModel();
+    double objective_mps = 0;
+    if (model_mps.isMip() || model_mps.isQp()) {
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      objective_mps = highs.getInfo().objective_function_value;
+    }
+
+    // The model name is taken from the file name, so restore it
+    std::string hbm_file = "round-trip-" + model + ".hbm";
+    REQUIRE(highs.writeModel(hbm_file) == HighsStatus::kOk);
+    REQUIRE(highs.readModel(hbm_file) == HighsStatus::kOk);
+    highs.passModelName(model_mps.lp_.model_name_);
+    const HighsModel& model_hbm = highs.getModel();
+    REQUIRE(model_hbm == model_mps);
+    REQUIRE(model_hbm.lp_.integrality_ == model_mps.lp_.integrality_);
+    if (model_mps.isMip() || model_mps.isQp()) {
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getInfo().objective_function_value == objective_mps);
+    }
+    std::remove(hbm_file.c_str());
+  }
+
+  // A model without names, other than the model name, which is taken
+  // from the file name
+  HighsLp lp;
+  lp.model_name_ = "round-trip";
+  lp.num_col_ = 2;
+  lp.num_row_ = 1;
+  lp.sense_ = ObjSense::kMaximize;
+  lp.offset_ = 1.5;
+  lp.col_cost_ = {1, 2};
+  lp.col_lower_ = {0, -inf};
+  lp.col_upper_ = {inf, 3};
+  lp.row_lower_ = {-inf};
+  lp.row_upper_ = {4};
+  lp.a_matrix_.start_ = {0, 1, 2};
+  lp.a_matrix_.index_ = {0, 0};
+  lp.a_matrix_.value_ = {1, 1};
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  HighsLp lp_passed = highs.getLp();
+  std::string hbm_file = "round-trip.hbm";
+  REQUIRE(highs.writeModel(hbm_file) == HighsStatus::kOk);
+  REQUIRE(highs.readModel(hbm_file) == HighsStatus::kOk);
+  REQUIRE(highs.getLp() == lp_passed);
+
+  // A truncated file is rejected
+  std::ifstream in(hbm_file, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(in)),
+                       std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream out(hbm_file, std::ios::binary);
+  out.write(contents.data(), contents.size() - 8);
+  out.close();
+  REQUIRE(highs.readModel(hbm_file) == HighsStatus::kError);
+
+  // As is a file that is not a binary model file
+  out.open(hbm_file, std::ios::binary);
+  out << "This is not a HiGHS binary model file";
+  out.close();
+  REQUIRE(highs.readModel(hbm_file) == HighsStatus::kError);
+  std::remove(hbm_file.c_str());
+}
+
 // No commas in test case name.
 TEST_CASE("filereader-read-mps-ems-lp", "[highs_filereader]") {
   std::string filename;
@@ -123,3 +123,77 @@ TEST_CASE("HotStart-rgn", "[highs_test_hot_start]") {
   // Cannot use the continuous solution as a hot start now
   REQUIRE(highs.setHotStart(hot_start) == HighsStatus::kError);
 }
+
+TEST_CASE("HotStart-lp-batch", "[highs_test_hot_start]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  // make sure that the global scheduler has threads for the batch
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.readModel(filename);
+  const HighsLp lp = highs.getLp();
+
+  // Define LPs by scaling a cost, the bounds on a column and the
+  // bounds on a row
+  const HighsInt num_lp = 12;
+  std::vector<HighsLpDelta> lp_delta(num_lp);
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+    HighsLpDelta& delta = lp_delta[iLp];
+    const double scale = 1 + 0.1 * iLp;
+    const HighsInt iCol = iLp % lp.num_col_;
+    const HighsInt iRow = iLp % lp.num_row_;
+    delta.cost_index.push_back(iCol);
+    delta.cost.push_back(scale * lp.col_cost_[iCol]);
+    delta.col_index.push_back(iCol);
+    delta.col_lower.push_back(lp.col_lower_[iCol]);
+    delta.col_upper.push_back(scale * 100);
+    delta.row_index.push_back(iRow);
+    delta.row_lower.push_back(lp.row_lower_[iRow] > -kHighsInf
+                                  ? scale * lp.row_lower_[iRow]
+                                  : -kHighsInf);
+    delta.row_upper.push_back(lp.row_upper_[iRow] < kHighsInf
+                                  ? scale * lp.row_upper_[iRow]
+                                  : kHighsInf);
+  }
+  std::vector<HighsModelStatus> model_status;
+  std::vector<double> objective_function_value;
+  std::vector<HighsSolution> solution;
+  std::vector<HighsBasis> basis;
+  REQUIRE(highs.solveLpBatch(lp_delta, model_status, objective_function_value,
+                             solution, basis) == HighsStatus::kOk);
+  REQUIRE(HighsInt(model_status.size()) == num_lp);
+
+  // Compare with solving each LP from scratch
+  Highs check;
+  check.setOptionValue("output_flag", dev_run);
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+    const HighsLpDelta& delta = lp_delta[iLp];
+    check.passModel(lp);
+    check.changeColsCost(1, delta.cost_index.data(), delta.cost.data());
+    check.changeColsBounds(1, delta.col_index.data(), delta.col_lower.data(),
+                           delta.col_upper.data());
+    check.changeRowsBounds(1, delta.row_index.data(), delta.row_lower.data(),
+                           delta.row_upper.data());
+    check.run();
+    REQUIRE(model_status[iLp] == check.getModelStatus());
+    if (model_status[iLp] != HighsModelStatus::kOptimal) continue;
+    const double check_objective =
+        check.getInfo().objective_function_value;
+    REQUIRE(std::fabs(objective_function_value[iLp] - check_objective) <=
+            double_equal_tolerance * std::max(1.0, std::fabs(check_objective)));
+    REQUIRE(basis[iLp].valid);
+    REQUIRE(solution[iLp].value_valid);
+  }
+  // The incumbent LP is not changed
+  REQUIRE(highs.getLp().col_cost_ == lp.col_cost_);
+
+  // Indices must be strictly increasing
+  lp_delta[0].col_index.assign(2, 0);
+  lp_delta[0].col_lower.assign(2, 0);
+  lp_delta[0].col_upper.assign(2, 1);
+  REQUIRE(highs.solveLpBatch(lp_delta, model_status, objective_function_value,
+                             solution, basis) == HighsStatus::kError);
+  Highs::resetGlobalScheduler(true);
+}
@@ -679,3 +679,106 @@ TEST_CASE("simplex-stats", "[highs_lp_solver]") {
   REQUIRE(simplex_stats.row_DSE_density > 0);
   if (dev_run) h.reportSimplexStats(stdout);
 }
+
+TEST_CASE("concurrent-lp-solver", "[highs_lp_solver]") {
+  // make sure that the global scheduler has threads for all the solvers
+  Highs::resetGlobalScheduler(true);
+  Highs h;
+  h.setOptionValue("output_flag", dev_run);
+  h.setOptionValue("threads", 3);
+  h.setOptionValue("presolve", kHighsOffString);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(h.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(h.run() == HighsStatus::kOk);
+  const double optimal_objective = h.getInfo().objective_function_value;
+
+  h.clearSolver();
+  h.setOptionValue("solver", kConcurrentString);
+  REQUIRE(h.run() == HighsStatus::kOk);
+  REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(h.getInfo().objective_function_value -
+                    optimal_objective) <
+          1e-6 * std::max(1.0, std::fabs(optimal_objective)));
+  // Whichever solver wins, crossover yields a basis unless PDLP wins
+  if (h.getInfo().pdlp_iteration_count == 0) REQUIRE(h.getBasis().valid);
+
+  // Hot start from the optimal basis
+  REQUIRE(h.run() == HighsStatus::kOk);
+  REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+
+  model_file = std::string(HIGHS_DIR) + "/check/instances/galenet.mps";
+  REQUIRE(h.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(h.run() == HighsStatus::kOk);
+  REQUIRE(h.getModelStatus() == HighsModelStatus::kInfeasible);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("parallel-primal-simplex", "[highs_lp_solver]") {
+  // The parallel primal simplex solver slices PRICE and CHUZC
+  // according to the simplex concurrency, so the slicing is tested
+  // whatever the number of threads
+  Highs h;
+  h.setOptionValue("output_flag", dev_run);
+  h.setOptionValue("presolve", kHighsOffString);
+  h.setOptionValue("simplex_strategy", kSimplexStrategyPrimal);
+  std::vector<std::string> models = {"adlittle", "25fv47", "shell"};
+  for (const std::string& model : models) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(h.readModel(model_file) == HighsStatus::kOk);
+    // Solve using Devex and steepest edge primal weights
+    for (HighsInt edge_weight_strategy = 1; edge_weight_strategy <= 2;
+         edge_weight_strategy++) {
+      h.setOptionValue("simplex_primal_edge_weight_strategy",
+                       edge_weight_strategy);
+      h.setOptionValue("parallel", kHighsOffString);
+      h.clearSolver();
+      REQUIRE(h.run() == HighsStatus::kOk);
+      REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+      const double optimal_objective = h.getInfo().objective_function_value;
+
+      h.setOptionValue("parallel", kHighsOnString);
+      h.clearSolver();
+      REQUIRE(h.run() == HighsStatus::kOk);
+      REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+      REQUIRE(std::fabs(h.getInfo().objective_function_value -
+                        optimal_objective) <
+              1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+    }
+  }
+}
+
+TEST_CASE("parallel-dual-simplex", "[highs_lp_solver]") {
+  // The parallel dual simplex solvers pack the pivotal row, find the
+  // BFRT candidates and update the dual values slice by slice, so
+  // check that they yield the same optimal objective as the serial
+  // dual simplex solver
+  Highs h;
+  h.setOptionValue("output_flag", dev_run);
+  h.setOptionValue("presolve", kHighsOffString);
+  std::vector<std::string> models = {"adlittle", "25fv47", "80bau3b"};
+  for (const std::string& model : models) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(h.readModel(model_file) == HighsStatus::kOk);
+    h.setOptionValue("simplex_strategy", kSimplexStrategyDual);
+    h.setOptionValue("parallel", kHighsOffString);
+    h.clearSolver();
+    REQUIRE(h.run() == HighsStatus::kOk);
+    REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+    const double optimal_objective = h.getInfo().objective_function_value;
+
+    for (HighsInt simplex_strategy :
+         {kSimplexStrategyDualTasks, kSimplexStrategyDualMulti}) {
+      h.setOptionValue("simplex_strategy", simplex_strategy);
+      h.setOptionValue("parallel", kHighsOnString);
+      h.clearSolver();
+      REQUIRE(h.run() == HighsStatus::kOk);
+      REQUIRE(h.getModelStatus() == HighsModelStatus::kOptimal);
+      REQUIRE(std::fabs(h.getInfo().objective_function_value -
+                        optimal_objective) <
+              1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+    }
+  }
+}
@@ -6,6 +6,55 @@
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
 
+TEST_CASE("MIP-strong-branching-threads", "[highs_test_mip_solver]") {
+  const double bell5_optimal_objective = 8966406.491519;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  // make sure that the global scheduler has threads for the strong branching
+  // LPs
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_strong_branching_threads", 4);
+  // Solve to optimality, rather than the default relative gap, so that
+  // the objective can be checked tightly
+  highs.setOptionValue("mip_rel_gap", 0);
+  highs.readModel(filename);
+
+  std::vector<int64_t> node_count;
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      bell5_optimal_objective) <
+            1e-6 * bell5_optimal_objective);
+    node_count.push_back(highs.getInfo().mip_node_count);
+  }
+  // the strong branching LPs are analysed in a fixed order, so the search
+  // does not depend on the timing of the threads
+  REQUIRE(node_count[0] == node_count[1]);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-heuristic-worker", "[highs_test_mip_solver]") {
+  const double bell5_optimal_objective = 8966406.491519;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  // make sure that the global scheduler has a spare thread for the sub-MIPs
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("mip_heuristic_worker", true);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    bell5_optimal_objective) <
+          1e-6 * bell5_optimal_objective);
+  Highs::resetGlobalScheduler(true);
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective,
                  const bool dev_run = false);
@@ -732,6 +781,43 @@ TEST_CASE("IP-with-fract-bounds-no-presolve", "[highs_test_mip_solver]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
 }
 
+TEST_CASE("MIP-search-workers", "[highs_test_mip_solver]") {
+  const double bell5_optimal_objective = 8966406.491519;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  // make sure that the global scheduler has threads for all workers
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_search_workers", 4);
+  // Solve to optimality, rather than the default relative gap, so that
+  // the objective can be checked tightly
+  highs.setOptionValue("mip_rel_gap", 0);
+  highs.readModel(filename);
+
+  std::vector<int64_t> node_count;
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      bell5_optimal_objective) <
+            1e-6 * bell5_optimal_objective);
+    node_count.push_back(highs.getInfo().mip_node_count);
+  }
+  // deterministic workers explore the same tree in each run
+  REQUIRE(node_count[0] == node_count[1]);
+
+  highs.setOptionValue("mip_search_deterministic", false);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    bell5_optimal_objective) <
+          1e-6 * bell5_optimal_objective);
+  Highs::resetGlobalScheduler(true);
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective, const bool dev_run) {
   double error = std::fabs(optimal_objective - require_optimal_objective) /
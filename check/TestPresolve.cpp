@@ -12,6 +12,8 @@ bool doubleEqual(const double v0, const double v1) {
 void presolveSolvePostsolve(const std::string& model_file,
                             const bool solve_relaxation = false);
 
+void checkSameResult(Highs& highs, Highs& highs1);
+
 TEST_CASE("presolve-solve-postsolve-lp", "[highs_test_presolve]") {
   std::string model_file =
       std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
@@ -639,3 +641,81 @@ TEST_CASE("presolve-slacks", "[highs_test_presolve]") {
   REQUIRE(h.getPresolvedLp().num_col_ == 2);
   REQUIRE(h.getPresolvedLp().num_row_ == 2);
 }
+
+TEST_CASE("presolve-reuse", "[highs_test_presolve]") {
+  for (std::string model : {"afiro", "adlittle", "25fv47", "shell"}) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("presolve_reuse", true);
+    highs.readModel(model_file);
+    const HighsLp lp = highs.getLp();
+
+    // Presolve the LP with perturbed costs, and compare the
+    // presolved LP obtained by reusing the reductions with that
+    // obtained by presolving from scratch
+    for (HighsInt k = 0; k < 4; k++) {
+      std::vector<double> cost = lp.col_cost_;
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+        cost[iCol] += ((iCol * (k + 1)) % 7 - 3) * 0.1;
+      REQUIRE(highs.changeColsCost(0, lp.num_col_ - 1, cost.data()) ==
+              HighsStatus::kOk);
+      if (k == 3) highs.changeObjectiveSense(ObjSense::kMaximize);
+      REQUIRE(highs.presolve() == HighsStatus::kOk);
+      const HighsLp& presolved_lp = highs.getPresolvedLp();
+
+      Highs highs1;
+      highs1.setOptionValue("output_flag", dev_run);
+      highs1.setOptionValue("presolve_reuse", true);
+      highs1.passModel(highs.getLp());
+      REQUIRE(highs1.presolve() == HighsStatus::kOk);
+      const HighsLp& presolved_lp1 = highs1.getPresolvedLp();
+      REQUIRE(presolved_lp.num_col_ == presolved_lp1.num_col_);
+      REQUIRE(presolved_lp.num_row_ == presolved_lp1.num_row_);
+      REQUIRE(std::fabs(presolved_lp.offset_ - presolved_lp1.offset_) <=
+              1e-8 * std::max(1.0, std::fabs(presolved_lp1.offset_)));
+      for (HighsInt iCol = 0; iCol < presolved_lp.num_col_; iCol++)
+        REQUIRE(std::fabs(presolved_lp.col_cost_[iCol] -
+                          presolved_lp1.col_cost_[iCol]) <= 1e-8);
+
+      // Solving with the reused reductions gives the same result as
+      // solving with full presolve
+      highs.clearSolver();
+      highs.run();
+      highs1.setOptionValue("presolve_reuse", false);
+      highs1.run();
+      checkSameResult(highs, highs1);
+      highs.changeObjectiveSense(ObjSense::kMinimize);
+    }
+
+    // Changing a bound means that the reductions can't be reused
+    highs.changeColCost(0, lp.col_cost_[0]);
+    highs.changeColBounds(0, lp.col_lower_[0], lp.col_upper_[0] + 1);
+    highs.clearSolver();
+    highs.run();
+    Highs highs1;
+    highs1.setOptionValue("output_flag", dev_run);
+    highs1.passModel(highs.getLp());
+    highs1.run();
+    checkSameResult(highs, highs1);
+  }
+}
+
+void checkSameResult(Highs& highs, Highs& highs1) {
+  const HighsModelStatus model_status = highs1.getModelStatus();
+  if (model_status == HighsModelStatus::kUnbounded ||
+      model_status == HighsModelStatus::kUnboundedOrInfeasible) {
+    REQUIRE((highs.getModelStatus() == HighsModelStatus::kUnbounded ||
+             highs.getModelStatus() ==
+                 HighsModelStatus::kUnboundedOrInfeasible));
+    return;
+  }
+  REQUIRE(highs.getModelStatus() == model_status);
+  if (model_status != HighsModelStatus::kOptimal) return;
+  const double objective_function_value =
+      highs1.getInfo().objective_function_value;
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    objective_function_value) <=
+          1e-8 * std::max(1.0, std::fabs(objective_function_value)));
+}
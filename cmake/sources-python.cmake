@@ -174,9 +174,11 @@ set(highs_sources_python
     src/interfaces/highs_c_api.cpp
     src/io/Filereader.cpp
     src/io/FilereaderEms.cpp
+    src/io/FilereaderHbm.cpp
     src/io/FilereaderLp.cpp
     src/io/FilereaderMps.cpp
     src/io/HighsIO.cpp
+    src/io/HighsMappedFile.cpp
     src/io/HMpsFF.cpp
     src/io/HMPSIO.cpp
     src/io/LoadOptions.cpp
@@ -211,6 +213,7 @@ set(highs_sources_python
     src/mip/HighsMipAnalysis.cpp
     src/mip/HighsMipSolver.cpp
     src/mip/HighsMipSolverData.cpp
+    src/mip/HighsMipWorker.cpp
     src/mip/HighsModkSeparator.cpp
     src/mip/HighsNodeQueue.cpp
     src/mip/HighsObjectiveFunction.cpp
@@ -263,7 +266,9 @@ set(highs_sources_python
     src/test/KktCh2.cpp
     src/test/DevKkt.cpp
     src/util/HFactor.cpp
+    src/util/HFactorBlock.cpp
     src/util/HFactorDebug.cpp
+    src/util/HFactorDense.cpp
     src/util/HFactorExtend.cpp
     src/util/HFactorRefactor.cpp
     src/util/HFactorUtils.cpp
@@ -271,6 +276,7 @@ set(highs_sources_python
     src/util/HighsLinearSumBounds.cpp
     src/util/HighsMatrixPic.cpp
     src/util/HighsMatrixUtils.cpp
+    src/util/HighsSimd.cpp
     src/util/HighsSort.cpp
     src/util/HighsSparseMatrix.cpp
     src/util/HighsUtils.cpp
@@ -287,9 +293,11 @@ set(highs_headers_python
     src/interfaces/highs_c_api.h
     src/io/Filereader.h
     src/io/FilereaderEms.h
+    src/io/FilereaderHbm.h
     src/io/FilereaderLp.h
     src/io/FilereaderMps.h
     src/io/HighsIO.h
+    src/io/HighsMappedFile.h
     src/io/HMpsFF.h
     src/io/HMPSIO.h
     src/io/LoadOptions.h
@@ -329,6 +337,7 @@ set(highs_headers_python
     src/mip/HighsMipAnalysis.h
     src/mip/HighsMipSolver.h
     src/mip/HighsMipSolverData.h
+    src/mip/HighsMipWorker.h
     src/mip/HighsModkSeparator.h
     src/mip/HighsNodeQueue.h
     src/mip/HighsObjectiveFunction.h
@@ -425,6 +434,7 @@ set(highs_headers_python
     src/util/HighsMemoryAllocation.h
     src/util/HighsRandom.h
     src/util/HighsRbTree.h
+    src/util/HighsSimd.h
     src/util/HighsSort.h
     src/util/HighsSparseMatrix.h
     src/util/HighsSparseVectorSum.h
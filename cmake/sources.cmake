@@ -174,9 +174,11 @@ set(highs_sources
     interfaces/highs_c_api.cpp
     io/Filereader.cpp
     io/FilereaderEms.cpp
+    io/FilereaderHbm.cpp
     io/FilereaderLp.cpp
     io/FilereaderMps.cpp
     io/HighsIO.cpp
+    io/HighsMappedFile.cpp
     io/HMpsFF.cpp
     io/HMPSIO.cpp
     io/LoadOptions.cpp
@@ -212,6 +214,7 @@ set(highs_sources
     mip/HighsMipAnalysis.cpp
     mip/HighsMipSolver.cpp
     mip/HighsMipSolverData.cpp
+    mip/HighsMipWorker.cpp
     mip/HighsModkSeparator.cpp
     mip/HighsNodeQueue.cpp
     mip/HighsObjectiveFunction.cpp
@@ -264,7 +267,9 @@ set(highs_sources
     test/KktCh2.cpp
     test/DevKkt.cpp
     util/HFactor.cpp
+    util/HFactorBlock.cpp
     util/HFactorDebug.cpp
+    util/HFactorDense.cpp
     util/HFactorExtend.cpp
     util/HFactorRefactor.cpp
     util/HFactorUtils.cpp
@@ -272,6 +277,7 @@ set(highs_sources
     util/HighsLinearSumBounds.cpp
     util/HighsMatrixPic.cpp
     util/HighsMatrixUtils.cpp
+    util/HighsSimd.cpp
     util/HighsSort.cpp
     util/HighsSparseMatrix.cpp
     util/HighsUtils.cpp
@@ -291,9 +297,11 @@ set(highs_headers
     interfaces/highs_c_api.h
     io/Filereader.h
     io/FilereaderEms.h
+    io/FilereaderHbm.h
     io/FilereaderLp.h
     io/FilereaderMps.h
     io/HighsIO.h
+    io/HighsMappedFile.h
     io/HMpsFF.h
     io/HMPSIO.h
     io/LoadOptions.h
@@ -333,6 +341,7 @@ set(highs_headers
     mip/HighsMipAnalysis.h
     mip/HighsMipSolver.h
     mip/HighsMipSolverData.h
+    mip/HighsMipWorker.h
     mip/HighsModkSeparator.h
     mip/HighsNodeQueue.h
     mip/HighsObjectiveFunction.h
@@ -429,6 +438,7 @@ set(highs_headers
     util/HighsMemoryAllocation.h
     util/HighsRandom.h
     util/HighsRbTree.h
+    util/HighsSimd.h
     util/HighsSort.h
     util/HighsSparseMatrix.h
     util/HighsSparseVectorSum.h
@@ -202,6 +202,20 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solve a batch of LPs, each obtained by applying a change
+   * to the costs and bounds of the incumbent LP. The LPs are solved
+   * in parallel using the simplex method on copies of the incumbent
+   * LP, each starting from the basis of the incumbent LP, which is
+   * solved first if it has no basis. The model status, objective
+   * function value, solution and basis of each LP are returned
+   */
+  HighsStatus solveLpBatch(const std::vector<HighsLpDelta>& lp_delta,
+                           std::vector<HighsModelStatus>& model_status,
+                           std::vector<double>& objective_function_value,
+                           std::vector<HighsSolution>& solution,
+                           std::vector<HighsBasis>& basis);
+
   /**
    * @brief Postsolve the incumbent model using a solution
    */
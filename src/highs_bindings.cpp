@@ -187,6 +187,20 @@ std::tuple<HighsStatus, HighsRanging> highs_getRanging(Highs* h) {
   return std::make_tuple(status, ranging);
 }
 
+std::tuple<HighsStatus, std::vector<HighsModelStatus>, std::vector<double>,
+           std::vector<HighsSolution>, std::vector<HighsBasis>>
+highs_solveLpBatch(Highs* h, const std::vector<HighsLpDelta>& lp_delta) {
+  std::vector<HighsModelStatus> model_status;
+  std::vector<double> objective_function_value;
+  std::vector<HighsSolution> solution;
+  std::vector<HighsBasis> basis;
+  HighsStatus status = h->solveLpBatch(lp_delta, model_status,
+                                       objective_function_value, solution,
+                                       basis);
+  return std::make_tuple(status, model_status, objective_function_value,
+                         solution, basis);
+}
+
 HighsStatus highs_addRow(Highs* h, double lower, double upper,
                          HighsInt num_new_nz, dense_array_t<HighsInt> indices,
                          dense_array_t<double> values) {
@@ -918,6 +932,13 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
                      &HighsOptions::mip_pscost_minreliable)
       .def_readwrite("mip_min_cliquetable_entries_for_parallelism",
                      &HighsOptions::mip_min_cliquetable_entries_for_parallelism)
+      .def_readwrite("mip_search_workers", &HighsOptions::mip_search_workers)
+      .def_readwrite("mip_search_deterministic",
+                     &HighsOptions::mip_search_deterministic)
+      .def_readwrite("mip_strong_branching_threads",
+                     &HighsOptions::mip_strong_branching_threads)
+      .def_readwrite("mip_heuristic_worker",
+                     &HighsOptions::mip_heuristic_worker)
       .def_readwrite("mip_report_level", &HighsOptions::mip_report_level)
       .def_readwrite("mip_feasibility_tolerance",
                      &HighsOptions::mip_feasibility_tolerance)
@@ -953,6 +974,8 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
       .def("postsolve", &highs_postsolve)
       .def("postsolve", &highs_mipPostsolve)
       .def("run", &Highs::run, py::call_guard<py::gil_scoped_release>())
+      .def("solveLpBatch", &highs_solveLpBatch,
+           py::call_guard<py::gil_scoped_release>())
       .def_static("resetGlobalScheduler", &Highs::resetGlobalScheduler)
       .def(
           "feasibilityRelaxation",
@@ -1154,6 +1177,16 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
       .def(py::init<>())
       .def_readwrite("simplex_time", &HighsIisInfo::simplex_time)
       .def_readwrite("simplex_iterations", &HighsIisInfo::simplex_iterations);
+  py::class_<HighsLpDelta>(m, "HighsLpDelta")
+      .def(py::init<>())
+      .def_readwrite("cost_index", &HighsLpDelta::cost_index)
+      .def_readwrite("cost", &HighsLpDelta::cost)
+      .def_readwrite("col_index", &HighsLpDelta::col_index)
+      .def_readwrite("col_lower", &HighsLpDelta::col_lower)
+      .def_readwrite("col_upper", &HighsLpDelta::col_upper)
+      .def_readwrite("row_index", &HighsLpDelta::row_index)
+      .def_readwrite("row_lower", &HighsLpDelta::row_lower)
+      .def_readwrite("row_upper", &HighsLpDelta::row_upper);
   py::class_<HighsLinearObjective>(m, "HighsLinearObjective")
       .def(py::init<>())
       .def_readwrite("weight", &HighsLinearObjective::weight)
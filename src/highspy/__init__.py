@@ -30,6 +30,7 @@ from ._core import (
     kHighsInf,
     kHighsIInf,
     HighsLinearObjective,
+    HighsLpDelta,
     HIGHS_VERSION_MAJOR,
     HIGHS_VERSION_MINOR,
     HIGHS_VERSION_PATCH,
@@ -75,6 +76,7 @@ __all__ = [
     "HighsBasis",
     "HighsRangingRecord",
     "HighsRanging",
+    "HighsLpDelta",
     "kHighsInf",
     "kHighsIInf",
     "HIGHS_VERSION_MAJOR",
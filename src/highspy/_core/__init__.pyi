@@ -281,6 +281,18 @@ class HighsLp:
 
     def __init__(self) -> None: ...
 
+class HighsLpDelta:
+    col_index: list[int]
+    col_lower: list[float]
+    col_upper: list[float]
+    cost: list[float]
+    cost_index: list[int]
+    row_index: list[int]
+    row_lower: list[float]
+    row_upper: list[float]
+
+    def __init__(self) -> None: ...
+
 class HighsLpMods:
     pass
 
@@ -405,6 +417,7 @@ class HighsOptions:
     mip_detect_symmetry: bool
     mip_feasibility_tolerance: float
     mip_heuristic_effort: float
+    mip_heuristic_worker: bool
     mip_lp_age_limit: int
     mip_max_improving_sols: int
     mip_max_leaves: int
@@ -417,6 +430,9 @@ class HighsOptions:
     mip_pscost_minreliable: int
     mip_rel_gap: float
     mip_report_level: int
+    mip_search_deterministic: bool
+    mip_search_workers: int
+    mip_strong_branching_threads: int
     objective_bound: float
     objective_target: float
     output_flag: bool
@@ -1008,6 +1024,15 @@ class _Highs:
         values: numpy.ndarray[typing.Any, numpy.dtype[numpy.float64]],
     ) -> HighsStatus: ...
     def solutionStatusToString(self, solution_status: int) -> str: ...
+    def solveLpBatch(
+        self, lp_delta: list[HighsLpDelta]
+    ) -> tuple[
+        HighsStatus,
+        list[HighsModelStatus],
+        list[float],
+        list[HighsSolution],
+        list[HighsBasis],
+    ]: ...
     def startCallback(self, callback_type: cb.HighsCallbackType) -> HighsStatus: ...
     def startCallbackInt(self, callback_type: int) -> HighsStatus: ...
     def stopCallback(self, callback_type: cb.HighsCallbackType) -> HighsStatus: ...
@@ -11,6 +11,7 @@
 #include <cctype>
 
 #include "io/FilereaderEms.h"
+#include "io/FilereaderHbm.h"
 #include "io/FilereaderLp.h"
 #include "io/FilereaderMps.h"
 #include "io/HighsIO.h"
@@ -64,6 +65,8 @@ Filereader* Filereader::getFilereader(const HighsLogOptions& log_options,
     reader = new FilereaderLp();
   } else if (lower_case_extension.compare("ems") == 0) {
     reader = new FilereaderEms();
+  } else if (lower_case_extension.compare("hbm") == 0) {
+    reader = new FilereaderHbm();
   } else {
     reader = NULL;
   }
@@ -0,0 +1,323 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbm.cpp
+ * @brief
+ */
+
+#include "io/FilereaderHbm.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "io/HighsMappedFile.h"
+
+namespace {
+
+const char kHbmMagic[8] = {'H', 'i', 'G', 'H', 'S', 'h', 'b', 'm'};
+const int64_t kHbmByteOrder = 0x0102030405060708;
+const size_t kHbmAlignment = 8;
+
+// Entries of the header that follow the magic string
+enum HbmHeaderEntry {
+  kHbmHeaderVersion = 0,
+  kHbmHeaderByteOrder,
+  kHbmHeaderIntSize,
+  kHbmHeaderNumCol,
+  kHbmHeaderNumRow,
+  kHbmHeaderNumNz,
+  kHbmHeaderSense,
+  kHbmHeaderOffset,
+  kHbmHeaderHasIntegrality,
+  kHbmHeaderHessianDim,
+  kHbmHeaderHessianFormat,
+  kHbmHeaderHessianNumNz,
+  kHbmHeaderNumColName,
+  kHbmHeaderNumRowName,
+  kHbmHeaderNamesSize,
+  kHbmHeaderCount
+};
+
+size_t hbmPaddedSize(const size_t size) {
+  return (size + kHbmAlignment - 1) / kHbmAlignment * kHbmAlignment;
+}
+
+void writeHbmPadding(std::ofstream& f, const size_t size) {
+  const char padding[kHbmAlignment] = {0};
+  f.write(padding, hbmPaddedSize(size) - size);
+}
+
+void writeHbmBytes(std::ofstream& f, const void* data, const size_t size) {
+  if (size) f.write(static_cast<const char*>(data), size);
+  writeHbmPadding(f, size);
+}
+
+template <typename T>
+void writeHbmBlock(std::ofstream& f, const std::vector<T>& block,
+                   const HighsInt count) {
+  assert(static_cast<HighsInt>(block.size()) >= count);
+  writeHbmBytes(f, block.data(), count * sizeof(T));
+}
+
+void writeHbmNames(std::ofstream& f, const std::vector<std::string>& names,
+                   const HighsInt count) {
+  for (HighsInt i = 0; i < count; i++)
+    f.write(names[i].c_str(), names[i].size() + 1);
+}
+
+// Cursor on the contents of a binary model file, checking that no
+// block extends beyond the end of the file
+class HbmBlockReader {
+ public:
+  HbmBlockReader(const char* data, const size_t size)
+      : data_(data), size_(size), pos_(0) {}
+
+  const char* bytes(const int64_t count, const size_t item_size) {
+    if (count < 0 || size_ < pos_ ||
+        static_cast<uint64_t>(count) > (size_ - pos_) / item_size)
+      return nullptr;
+    const char* block = data_ + pos_;
+    pos_ += hbmPaddedSize(count * item_size);
+    return block;
+  }
+
+  template <typename T>
+  bool block(const int64_t count, std::vector<T>& values) {
+    const char* data = bytes(count, sizeof(T));
+    if (!data) return false;
+    values.resize(count);
+    if (count) std::memcpy(values.data(), data, count * sizeof(T));
+    return true;
+  }
+
+  // Integers are converted if the file was written with a different
+  // size of HighsInt
+  bool intBlock(const int64_t count, const int64_t int_size,
+                std::vector<HighsInt>& values) {
+    if (int_size == sizeof(HighsInt)) return block(count, values);
+    const char* data = bytes(count, int_size);
+    if (!data) return false;
+    values.resize(count);
+    for (int64_t i = 0; i < count; i++) {
+      if (int_size == sizeof(int32_t)) {
+        int32_t value;
+        std::memcpy(&value, data + i * int_size, int_size);
+        values[i] = value;
+      } else {
+        int64_t value;
+        std::memcpy(&value, data + i * int_size, int_size);
+        if (value > kHighsIInf) return false;
+        values[i] = value;
+      }
+    }
+    return true;
+  }
+
+  bool atEnd() const { return pos_ == size_; }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t pos_;
+};
+
+bool readHbmName(const char*& pos, const char* end, std::string& name) {
+  const char* name_end =
+      static_cast<const char*>(std::memchr(pos, '\0', end - pos));
+  if (!name_end) return false;
+  name.assign(pos, name_end);
+  pos = name_end + 1;
+  return true;
+}
+
+}  // namespace
+
+FilereaderRetcode FilereaderHbm::readModelFromFile(const HighsOptions& options,
+                                                   const std::string filename,
+                                                   HighsModel& model) {
+  HighsMappedFile file;
+  if (!file.open(filename)) return FilereaderRetcode::kFileNotFound;
+
+  const size_t header_size =
+      sizeof(kHbmMagic) + kHbmHeaderCount * sizeof(int64_t);
+  if (file.size() < header_size ||
+      std::memcmp(file.data(), kHbmMagic, sizeof(kHbmMagic)) != 0) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "File %s is not a HiGHS binary model file\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  int64_t header[kHbmHeaderCount];
+  std::memcpy(header, file.data() + sizeof(kHbmMagic), sizeof(header));
+  if (header[kHbmHeaderByteOrder] != kHbmByteOrder) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model file %s was written on a machine with "
+                 "a different byte order\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  if (header[kHbmHeaderVersion] != kHbmVersion) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model file %s has version %d, but only "
+                 "version %d is supported\n",
+                 filename.c_str(), (int)header[kHbmHeaderVersion],
+                 (int)kHbmVersion);
+    return FilereaderRetcode::kParserError;
+  }
+
+  const int64_t int_size = header[kHbmHeaderIntSize];
+  const int64_t num_col = header[kHbmHeaderNumCol];
+  const int64_t num_row = header[kHbmHeaderNumRow];
+  const int64_t num_nz = header[kHbmHeaderNumNz];
+  const int64_t hessian_dim = header[kHbmHeaderHessianDim];
+  const int64_t hessian_num_nz = header[kHbmHeaderHessianNumNz];
+  const int64_t num_col_name = header[kHbmHeaderNumColName];
+  const int64_t num_row_name = header[kHbmHeaderNumRowName];
+  const bool header_ok =
+      (int_size == sizeof(int32_t) || int_size == sizeof(int64_t)) &&
+      num_col >= 0 && num_col < kHighsIInf && num_row >= 0 &&
+      num_row < kHighsIInf && num_nz >= 0 && num_nz <= kHighsIInf &&
+      hessian_dim >= 0 && hessian_dim <= num_col && hessian_num_nz >= 0 &&
+      hessian_num_nz <= kHighsIInf &&
+      (num_col_name == 0 || num_col_name == num_col) &&
+      (num_row_name == 0 || num_row_name == num_row);
+
+  HighsLp& lp = model.lp_;
+  HighsHessian& hessian = model.hessian_;
+  HbmBlockReader reader(file.data() + header_size, file.size() - header_size);
+  bool read_ok = header_ok;
+  if (read_ok) {
+    lp.num_col_ = num_col;
+    lp.num_row_ = num_row;
+    lp.sense_ = header[kHbmHeaderSense] == (int64_t)ObjSense::kMaximize
+                    ? ObjSense::kMaximize
+                    : ObjSense::kMinimize;
+    std::memcpy(&lp.offset_, &header[kHbmHeaderOffset], sizeof(double));
+    read_ok = reader.block(num_col, lp.col_cost_) &&
+              reader.block(num_col, lp.col_lower_) &&
+              reader.block(num_col, lp.col_upper_) &&
+              reader.block(num_row, lp.row_lower_) &&
+              reader.block(num_row, lp.row_upper_) &&
+              reader.intBlock(num_col + 1, int_size, lp.a_matrix_.start_) &&
+              reader.intBlock(num_nz, int_size, lp.a_matrix_.index_) &&
+              reader.block(num_nz, lp.a_matrix_.value_);
+  }
+  if (read_ok && header[kHbmHeaderHasIntegrality])
+    read_ok = reader.block(num_col, lp.integrality_);
+  if (read_ok && hessian_dim) {
+    hessian.dim_ = hessian_dim;
+    hessian.format_ =
+        header[kHbmHeaderHessianFormat] == (int64_t)HessianFormat::kSquare
+            ? HessianFormat::kSquare
+            : HessianFormat::kTriangular;
+    read_ok = reader.intBlock(hessian_dim + 1, int_size, hessian.start_) &&
+              reader.intBlock(hessian_num_nz, int_size, hessian.index_) &&
+              reader.block(hessian_num_nz, hessian.value_);
+  }
+  const char* names = nullptr;
+  const int64_t names_size = header[kHbmHeaderNamesSize];
+  if (read_ok) {
+    names = reader.bytes(names_size, 1);
+    read_ok = names && reader.atEnd();
+  }
+  if (read_ok) {
+    const char* names_end = names + names_size;
+    read_ok = readHbmName(names, names_end, lp.objective_name_);
+    lp.col_names_.resize(num_col_name);
+    for (int64_t iCol = 0; read_ok && iCol < num_col_name; iCol++)
+      read_ok = readHbmName(names, names_end, lp.col_names_[iCol]);
+    lp.row_names_.resize(num_row_name);
+    for (int64_t iRow = 0; read_ok && iRow < num_row_name; iRow++)
+      read_ok = readHbmName(names, names_end, lp.row_names_[iRow]);
+  }
+  if (!read_ok) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model file %s is corrupt\n", filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.setMatrixDimensions();
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderHbm::writeModelToFile(const HighsOptions& options,
+                                            const std::string filename,
+                                            const HighsModel& model) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.a_matrix_.isColwise());
+  std::ofstream f;
+  f.open(filename, std::ios::out | std::ios::binary);
+  if (!f.is_open()) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  const HighsInt num_nz = lp.a_matrix_.numNz();
+  const HighsInt hessian_num_nz = hessian.dim_ > 0 ? hessian.numNz() : 0;
+  const bool has_integrality =
+      static_cast<HighsInt>(lp.integrality_.size()) == lp.num_col_;
+  const HighsInt num_col_name =
+      static_cast<HighsInt>(lp.col_names_.size()) == lp.num_col_ ? lp.num_col_
+                                                                 : 0;
+  const HighsInt num_row_name =
+      static_cast<HighsInt>(lp.row_names_.size()) == lp.num_row_ ? lp.num_row_
+                                                                 : 0;
+  int64_t names_size = lp.objective_name_.size() + 1;
+  for (HighsInt iCol = 0; iCol < num_col_name; iCol++)
+    names_size += lp.col_names_[iCol].size() + 1;
+  for (HighsInt iRow = 0; iRow < num_row_name; iRow++)
+    names_size += lp.row_names_[iRow].size() + 1;
+
+  int64_t header[kHbmHeaderCount];
+  header[kHbmHeaderVersion] = kHbmVersion;
+  header[kHbmHeaderByteOrder] = kHbmByteOrder;
+  header[kHbmHeaderIntSize] = sizeof(HighsInt);
+  header[kHbmHeaderNumCol] = lp.num_col_;
+  header[kHbmHeaderNumRow] = lp.num_row_;
+  header[kHbmHeaderNumNz] = num_nz;
+  header[kHbmHeaderSense] = (int64_t)lp.sense_;
+  std::memcpy(&header[kHbmHeaderOffset], &lp.offset_, sizeof(double));
+  header[kHbmHeaderHasIntegrality] = has_integrality;
+  header[kHbmHeaderHessianDim] = hessian.dim_ > 0 ? hessian.dim_ : 0;
+  header[kHbmHeaderHessianFormat] = (int64_t)hessian.format_;
+  header[kHbmHeaderHessianNumNz] = hessian_num_nz;
+  header[kHbmHeaderNumColName] = num_col_name;
+  header[kHbmHeaderNumRowName] = num_row_name;
+  header[kHbmHeaderNamesSize] = names_size;
+
+  f.write(kHbmMagic, sizeof(kHbmMagic));
+  f.write(reinterpret_cast<const char*>(header), sizeof(header));
+  writeHbmBlock(f, lp.col_cost_, lp.num_col_);
+  writeHbmBlock(f, lp.col_lower_, lp.num_col_);
+  writeHbmBlock(f, lp.col_upper_, lp.num_col_);
+  writeHbmBlock(f, lp.row_lower_, lp.num_row_);
+  writeHbmBlock(f, lp.row_upper_, lp.num_row_);
+  writeHbmBlock(f, lp.a_matrix_.start_, lp.num_col_ + 1);
+  writeHbmBlock(f, lp.a_matrix_.index_, num_nz);
+  writeHbmBlock(f, lp.a_matrix_.value_, num_nz);
+  if (has_integrality) writeHbmBlock(f, lp.integrality_, lp.num_col_);
+  if (hessian.dim_ > 0) {
+    writeHbmBlock(f, hessian.start_, hessian.dim_ + 1);
+    writeHbmBlock(f, hessian.index_, hessian_num_nz);
+    writeHbmBlock(f, hessian.value_, hessian_num_nz);
+  }
+  f.write(lp.objective_name_.c_str(), lp.objective_name_.size() + 1);
+  writeHbmNames(f, lp.col_names_, num_col_name);
+  writeHbmNames(f, lp.row_names_, num_row_name);
+  writeHbmPadding(f, names_size);
+  f.close();
+  if (!f) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing HiGHS binary model file %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,45 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbm.h
+ * @brief Reader and writer for HiGHS binary model (.hbm) files
+ */
+
+#ifndef IO_FILEREADER_HBM_H_
+#define IO_FILEREADER_HBM_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+
+// A HiGHS binary model file consists of a header, followed by the
+// arrays of the model in contiguous blocks, each padded to a multiple
+// of 8 bytes:
+//
+// col_cost, col_lower, col_upper, row_lower, row_upper,
+// a_matrix start, index and value (column-wise),
+// integrality (if the model has any),
+// Hessian start, index and value (if the model has a Hessian),
+// names (null-terminated objective, column and row names)
+//
+// The header records the size of HighsInt used to write the file, so
+// files written by a build with 32-bit HighsInt can be read by a build
+// with 64-bit HighsInt, and vice versa. Files are written in the byte
+// order of the machine, and cannot be read on a machine with a
+// different byte order.
+const HighsInt kHbmVersion = 1;
+
+class FilereaderHbm : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
+#include "parallel/HighsParallel.h"
 
 using free_format_parser::HMpsFF;
 
@@ -29,6 +30,12 @@ FilereaderRetcode FilereaderMps::readModelFromFile(const HighsOptions& options,
     HMpsFF parser{};
     if (options.time_limit < kHighsInf && options.time_limit > 0)
       parser.time_limit = options.time_limit;
+    if (options.mps_parser_parallel) {
+      // make sure global scheduler is initialized before parsing in
+      // parallel
+      highs::parallel::initialize_scheduler(options.threads);
+      parser.parallel_parse = true;
+    }
 
     FreeFormatParserReturnCode result =
         parser.loadProblem(options.log_options, filename, model);
@@ -8,7 +8,9 @@
 
 #include "io/HMpsFF.h"
 
+#include "io/HighsMappedFile.h"
 #include "lp_data/HighsModelUtils.h"
+#include "parallel/HighsParallel.h"
 
 #ifdef ZLIB_FOUND
 #include "../extern/zstr/zstr.hpp"
@@ -18,11 +20,85 @@ namespace free_format_parser {
 
 const bool kNoClockCalls = false;
 
+// Target number of bytes of the COLUMNS section in each chunk parsed
+// by the parallel reader
+const size_t kColumnsChunkSize = 1 << 16;
+
+namespace {
+
+// Read-only stream buffer on the file contents, so that the sections
+// other than COLUMNS are parsed as when reading from a file stream
+class MpsMemoryStreambuf : public std::streambuf {
+ public:
+  MpsMemoryStreambuf(const char* data, size_t size) {
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+  }
+
+ protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+    char* pos;
+    if (dir == std::ios_base::beg)
+      pos = eback() + off;
+    else if (dir == std::ios_base::cur)
+      pos = gptr() + off;
+    else
+      pos = egptr() + off;
+    if (pos < eback() || pos > egptr()) return pos_type(off_type(-1));
+    setg(eback(), pos, egptr());
+    return pos_type(off_type(pos - eback()));
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+
+bool isMpsSpace(const char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+         c == '\r';
+}
+
+// Sets [word_begin, word_end) to the next word in [pos, end), returning
+// false if there is none
+bool nextMpsWord(const char*& pos, const char* end, const char*& word_begin,
+                 const char*& word_end) {
+  while (pos < end && isMpsSpace(*pos)) pos++;
+  word_begin = pos;
+  while (pos < end && !isMpsSpace(*pos)) pos++;
+  word_end = pos;
+  return word_begin < word_end;
+}
+
+const char* nextMpsLine(const char* pos, const char* end) {
+  const char* eol =
+      static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+  return eol ? eol + 1 : end;
+}
+
+// As in HMpsFF::getMpsLine, lines that are empty or have '*' in the
+// first column are skipped. Otherwise, [line_begin, line_end) is set to
+// the trimmed line
+bool isMpsDataLine(const char* line, const char* end, const char*& line_begin,
+                   const char*& line_end) {
+  if (line == end || *line == '*') return false;
+  line_begin = line;
+  line_end = end;
+  while (line_begin < line_end && isMpsSpace(*line_begin)) line_begin++;
+  while (line_end > line_begin && isMpsSpace(line_end[-1])) line_end--;
+  return line_begin < line_end;
+}
+
+}  // namespace
+
 FreeFormatParserReturnCode HMpsFF::loadProblem(
     const HighsLogOptions& log_options, const std::string filename,
     HighsModel& model) {
   HighsLp& lp = model.lp_;
   HighsHessian& hessian = model.hessian_;
+  const double parse_start_time = getWallTime();
   FreeFormatParserReturnCode result = parse(log_options, filename);
   if (result != FreeFormatParserReturnCode::kSuccess) return result;
 
@@ -77,6 +153,10 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
   if (status) return FreeFormatParserReturnCode::kParserError;
   status = fillHessian(log_options);
   if (status) return FreeFormatParserReturnCode::kParserError;
+  highsLogUser(log_options, HighsLogType::kInfo,
+               "MPS file parsed in %.2fs%s\n",
+               getWallTime() - parse_start_time,
+               parallel_parse ? " using the parallel reader" : "");
 
   lp.num_row_ = num_row;
   lp.num_col_ = num_col;
@@ -128,6 +208,13 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
 }
 
 HighsInt HMpsFF::fillMatrix(const HighsLogOptions& log_options) {
+  if (!a_start.empty()) {
+    // The matrix has been filled by parseColsParallel, but columns
+    // without entries may have been added in subsequent sections
+    assert(static_cast<size_t>(num_nz) == a_index.size());
+    a_start.resize(num_col + 1, num_nz);
+    return 0;
+  }
   size_t num_entries = entries.size();
   if (num_entries != static_cast<size_t>(num_nz)) return 1;
 
@@ -239,10 +326,24 @@ bool HMpsFF::getMpsLine(std::istream& file, std::string& strline, bool& skip) {
 
 FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
                                          const std::string& filename) {
-  HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
-
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
+  if (parallel_parse) {
+    HighsMappedFile buffer;
+    if (!buffer.open(filename)) {
+      highsLogDev(log_options, HighsLogType::kInfo,
+                  "readMPS: Not opened file OK\n");
+      return FreeFormatParserReturnCode::kFileNotFound;
+    }
+    MpsMemoryStreambuf streambuf(buffer.data(), buffer.size());
+    std::istream f(&streambuf);
+    buffer_begin = buffer.data();
+    buffer_end = buffer.data() + buffer.size();
+    FreeFormatParserReturnCode result = parseSections(log_options, f);
+    buffer_begin = nullptr;
+    buffer_end = nullptr;
+    return result;
+  }
 #ifdef ZLIB_FOUND
   zstr::ifstream f;
   try {
@@ -255,89 +356,90 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
   std::ifstream f;
   f.open(filename.c_str(), std::ios::in);
 #endif
-  if (f.is_open()) {
-    start_time = getWallTime();
-    num_row = 0;
-    num_col = 0;
-    num_nz = 0;
-    cost_row_location = -1;
-    // Indicate that no duplicate rows or columns have been found
-    has_duplicate_row_name_ = false;
-    has_duplicate_col_name_ = false;
-    // parsing loop
-    while (keyword != HMpsFF::Parsekey::kFail &&
-           keyword != HMpsFF::Parsekey::kEnd &&
-           keyword != HMpsFF::Parsekey::kTimeout) {
-      if (cannotParseSection(log_options, keyword)) {
-        f.close();
-        return FreeFormatParserReturnCode::kParserError;
-      }
-      switch (keyword) {
-        case HMpsFF::Parsekey::kObjsense:
-          keyword = parseObjsense(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRows:
-          keyword = parseRows(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kCols:
-          keyword = parseCols(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRhs:
-          keyword = parseRhs(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kBounds:
-          keyword = parseBounds(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRanges:
-          keyword = parseRanges(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kQmatrix:
-        case HMpsFF::Parsekey::kQuadobj:
-          keyword = parseHessian(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kQsection:
-        case HMpsFF::Parsekey::kQcmatrix:
-          keyword = parseQuadRows(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kCsection:
-          keyword = parseCones(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kSets:
-        case HMpsFF::Parsekey::kSos:
-          keyword = parseSos(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kFail:
-          f.close();
-          return FreeFormatParserReturnCode::kParserError;
-        case HMpsFF::Parsekey::kFixedFormat:
-          f.close();
-          return FreeFormatParserReturnCode::kFixedFormat;
-        default:
-          keyword = parseDefault(log_options, f);
-          break;
-      }
-    }
-
-    // Assign bounds to columns that remain binary by default
-    for (HighsInt colidx = 0; colidx < num_col; colidx++) {
-      if (col_binary[colidx]) {
-        col_lower[colidx] = 0.0;
-        col_upper[colidx] = 1.0;
-      }
-    }
-
-    if (keyword == HMpsFF::Parsekey::kFail) {
-      f.close();
-      return FreeFormatParserReturnCode::kParserError;
-    }
-  } else {
+  if (!f.is_open()) {
     highsLogDev(log_options, HighsLogType::kInfo,
                 "readMPS: Not opened file OK\n");
     f.close();
     return FreeFormatParserReturnCode::kFileNotFound;
   }
-
+  FreeFormatParserReturnCode result = parseSections(log_options, f);
   f.close();
+  return result;
+}
+
+FreeFormatParserReturnCode HMpsFF::parseSections(
+    const HighsLogOptions& log_options, std::istream& f) {
+  HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
+
+  start_time = getWallTime();
+  num_row = 0;
+  num_col = 0;
+  num_nz = 0;
+  cost_row_location = -1;
+  // Indicate that no duplicate rows or columns have been found
+  has_duplicate_row_name_ = false;
+  has_duplicate_col_name_ = false;
+  // parsing loop
+  while (keyword != HMpsFF::Parsekey::kFail &&
+         keyword != HMpsFF::Parsekey::kEnd &&
+         keyword != HMpsFF::Parsekey::kTimeout) {
+    if (cannotParseSection(log_options, keyword))
+      return FreeFormatParserReturnCode::kParserError;
+    switch (keyword) {
+      case HMpsFF::Parsekey::kObjsense:
+        keyword = parseObjsense(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRows:
+        keyword = parseRows(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kCols:
+        keyword = buffer_begin ? parseColsParallel(log_options, f)
+                               : parseCols(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRhs:
+        keyword = parseRhs(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kBounds:
+        keyword = parseBounds(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRanges:
+        keyword = parseRanges(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kQmatrix:
+      case HMpsFF::Parsekey::kQuadobj:
+        keyword = parseHessian(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kQsection:
+      case HMpsFF::Parsekey::kQcmatrix:
+        keyword = parseQuadRows(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kCsection:
+        keyword = parseCones(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kSets:
+      case HMpsFF::Parsekey::kSos:
+        keyword = parseSos(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kFail:
+        return FreeFormatParserReturnCode::kParserError;
+      case HMpsFF::Parsekey::kFixedFormat:
+        return FreeFormatParserReturnCode::kFixedFormat;
+      default:
+        keyword = parseDefault(log_options, f);
+        break;
+    }
+  }
+
+  // Assign bounds to columns that remain binary by default
+  for (HighsInt colidx = 0; colidx < num_col; colidx++) {
+    if (col_binary[colidx]) {
+      col_lower[colidx] = 0.0;
+      col_upper[colidx] = 1.0;
+    }
+  }
+
+  if (keyword == HMpsFF::Parsekey::kFail)
+    return FreeFormatParserReturnCode::kParserError;
 
   if (keyword == HMpsFF::Parsekey::kTimeout)
     return FreeFormatParserReturnCode::kTimeout;
@@ -403,6 +505,10 @@ HMpsFF::Parsekey HMpsFF::checkFirstWord(std::string& strline, size_t& start,
   if (word == "QCMATRIX" || word == "QSECTION" || word == "CSECTION")
     section_args = strline.substr(end, strline.length());
 
+  return getKeyword(word);
+}
+
+HMpsFF::Parsekey HMpsFF::getKeyword(const std::string& word) const {
   if (word == "NAME")
     return HMpsFF::Parsekey::kName;
   else if (word == "OBJSENSE")
@@ -952,6 +1058,352 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
   return Parsekey::kFail;
 }
 
+HMpsFF::Parsekey HMpsFF::parseColsParallel(const HighsLogOptions& log_options,
+                                           std::istream& file) {
+  assert(num_col == 0);
+  assert(buffer_begin);
+  const std::streamoff offset = file.tellg();
+  if (offset < 0) return Parsekey::kFail;
+  const char* cols_begin = buffer_begin + offset;
+
+  // Find the end of the COLUMNS section, being the first line that
+  // starts with a keyword. Keywords are upper case words of at least
+  // two characters
+  std::string word;
+  const char* cols_end = cols_begin;
+  while (cols_end < buffer_end) {
+    const char* next = nextMpsLine(cols_end, buffer_end);
+    const char *line_begin, *line_end, *word_begin, *word_end;
+    if (isMpsDataLine(cols_end, next, line_begin, line_end) &&
+        nextMpsWord(line_begin, line_end, word_begin, word_end) &&
+        word_end - word_begin > 1 && word_end - word_begin <= 11 &&
+        *word_begin >= 'A' && *word_begin <= 'Z') {
+      word.assign(word_begin, word_end);
+      if (getKeyword(word) != Parsekey::kNone) break;
+    }
+    cols_end = next;
+  }
+
+  // Moves a position in the COLUMNS section to the start of the next
+  // line that defines a new column, so that no column is split
+  // between chunks
+  auto columnBoundary = [&](const char* pos) {
+    const char *line_begin, *line_end, *name_begin, *name_end, *marker_begin,
+        *marker_end;
+    auto columnLine = [&](const char* line, const char* next) {
+      if (!isMpsDataLine(line, next, line_begin, line_end)) return false;
+      const char* word_pos = line_begin;
+      nextMpsWord(word_pos, line_end, name_begin, name_end);
+      nextMpsWord(word_pos, line_end, marker_begin, marker_end);
+      return std::string(marker_begin, marker_end) != "'MARKER'";
+    };
+    const char* line = pos;
+    while (line > cols_begin && line[-1] != '\n') line--;
+    // Integrality markers don't change the current column
+    std::string colname = "";
+    for (const char* next = line; next > cols_begin;) {
+      const char* prev = next - 1;
+      while (prev > cols_begin && prev[-1] != '\n') prev--;
+      if (columnLine(prev, next)) {
+        colname.assign(name_begin, name_end);
+        break;
+      }
+      next = prev;
+    }
+    while (line < cols_end) {
+      const char* next = nextMpsLine(line, cols_end);
+      if (columnLine(line, next) &&
+          colname.compare(0, std::string::npos, name_begin,
+                          name_end - name_begin) != 0)
+        break;
+      line = next;
+    }
+    return line;
+  };
+
+  const size_t cols_size = cols_end - cols_begin;
+  const size_t num_chunk = std::max(size_t{1}, cols_size / kColumnsChunkSize);
+  std::vector<ColumnsChunk> chunks(num_chunk);
+  const char* chunk_begin = cols_begin;
+  for (size_t iChunk = 0; iChunk < num_chunk; iChunk++) {
+    chunks[iChunk].begin = chunk_begin;
+    if (iChunk + 1 < num_chunk)
+      chunk_begin = std::max(
+          chunk_begin,
+          columnBoundary(cols_begin + (iChunk + 1) * (cols_size / num_chunk)));
+    else
+      chunk_begin = cols_end;
+    chunks[iChunk].end = chunk_begin;
+  }
+
+  highs::parallel::for_each(
+      0, (HighsInt)num_chunk, [&](HighsInt start, HighsInt end) {
+        for (HighsInt iChunk = start; iChunk < end; iChunk++)
+          parseColumnsChunk(chunks[iChunk]);
+      });
+
+  // Merge the chunks into the constraint matrix, resolving the
+  // column names and integrality markers
+  size_t chunks_num_nz = 0;
+  for (const ColumnsChunk& chunk : chunks) chunks_num_nz += chunk.index.size();
+  a_start.assign(1, 0);
+  a_index.reserve(chunks_num_nz);
+  a_value.reserve(chunks_num_nz);
+  bool integral_cols = false;
+  for (ColumnsChunk& chunk : chunks) {
+    size_t num_message = chunk.message.size();
+    const bool marker_error =
+        chunk.num_marker && chunk.first_marker_is_intorg == integral_cols;
+    if (marker_error) num_message = chunk.first_marker_message;
+    for (size_t iMessage = 0; iMessage < num_message; iMessage++)
+      highsLogUser(log_options, chunk.message[iMessage].first, "%s",
+                   chunk.message[iMessage].second.c_str());
+    if (marker_error) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "Integrality marker error in COLUMNS section of MPS file\n");
+      return Parsekey::kFail;
+    }
+    if (chunk.status != Parsekey::kNone) return chunk.status;
+
+    const HighsInt chunk_num_col = chunk.col_name.size();
+    for (HighsInt iCol = 0; iCol < chunk_num_col; iCol++) {
+      std::string& colname = chunk.col_name[iCol];
+      auto ret = colname2idx.emplace(colname, num_col++);
+      if (!ret.second) {
+        // Duplicate col name
+        if (!has_duplicate_col_name_) {
+          // This is the first so record it
+          has_duplicate_col_name_ = true;
+          duplicate_col_name_ = colname;
+          duplicate_col_name_index0_ = ret.first->second;
+          duplicate_col_name_index1_ = num_col - 1;
+        }
+      }
+      col_names.push_back(std::move(colname));
+      const bool integral =
+          integral_cols != (chunk.col_marker_parity[iCol] != 0);
+      col_integrality.push_back(integral ? HighsVarType::kInteger
+                                         : HighsVarType::kContinuous);
+      col_binary.push_back(integral && kintegerVarsInColumnsAreBinary);
+      col_lower.push_back(0.0);
+      col_upper.push_back(kHighsInf);
+      if (chunk.col_cost[iCol])
+        coeffobj.push_back(std::make_pair(num_col - 1, chunk.col_cost[iCol]));
+      for (HighsInt iEl = chunk.col_start[iCol];
+           iEl < chunk.col_start[iCol + 1]; iEl++) {
+        a_index.push_back(chunk.index[iEl]);
+        a_value.push_back(chunk.value[iEl]);
+      }
+      a_start.push_back(a_index.size());
+    }
+    if (chunk.num_marker & 1) integral_cols = !integral_cols;
+    chunk = ColumnsChunk();
+  }
+  num_nz = a_index.size();
+
+  // As in parseCols, the COLUMNS section must be followed by another
+  // section
+  if (cols_end == buffer_end) return Parsekey::kFail;
+  highsLogDev(log_options, HighsLogType::kInfo, "readMPS: Read COLUMNS OK\n");
+  file.seekg(cols_end - buffer_begin);
+  std::string strline;
+  size_t start, end;
+  bool skip;
+  if (!getMpsLine(file, strline, skip) || skip) return Parsekey::kFail;
+  return checkFirstWord(strline, start, end, word);
+}
+
+void HMpsFF::parseColumnsChunk(ColumnsChunk& chunk) {
+  std::string colname = "";
+  std::string marker, word;
+  uint8_t marker_parity = 0;
+  HighsInt num_line = 0;
+  std::vector<std::pair<HighsInt, HighsInt>> col_entries;
+  std::vector<std::pair<HighsInt, HighsInt>> duplicates;
+  chunk.col_start.assign(1, 0);
+
+  auto addMessage = [&chunk](const HighsLogType type, std::string message) {
+    chunk.message.emplace_back(type, std::move(message));
+  };
+
+  // Complete the current column, ignoring any duplicate entries. These
+  // are identified by sorting the entries rather than by using a
+  // vector of dimension num_row, since there are many chunks
+  auto finishColumn = [&]() {
+    if (chunk.col_name.size() < chunk.col_start.size()) return;
+    const HighsInt from = chunk.col_start.back();
+    const HighsInt to = chunk.index.size();
+    col_entries.clear();
+    for (HighsInt iEl = from; iEl < to; iEl++)
+      col_entries.push_back(std::make_pair(chunk.index[iEl], iEl));
+    std::sort(col_entries.begin(), col_entries.end());
+    duplicates.clear();
+    for (size_t iEntry = 1; iEntry < col_entries.size(); iEntry++) {
+      if (col_entries[iEntry].first == col_entries[iEntry - 1].first)
+        duplicates.push_back(std::make_pair(col_entries[iEntry].second,
+                                            col_entries[iEntry].first));
+    }
+    HighsInt col_end = to;
+    if (!duplicates.empty()) {
+      // Keep the first entry in each row, reporting the others in the
+      // order of the file
+      std::sort(duplicates.begin(), duplicates.end());
+      for (auto& duplicate : duplicates) {
+        chunk.index[duplicate.first] = -1;
+        addMessage(HighsLogType::kWarning,
+                   "Column \"" + colname +
+                       "\" has duplicate nonzero in row \"" +
+                       row_names[duplicate.second] + "\"\n");
+      }
+      col_end = from;
+      for (HighsInt iEl = from; iEl < to; iEl++) {
+        if (chunk.index[iEl] < 0) continue;
+        chunk.index[col_end] = chunk.index[iEl];
+        chunk.value[col_end] = chunk.value[iEl];
+        col_end++;
+      }
+      chunk.index.resize(col_end);
+      chunk.value.resize(col_end);
+    }
+    chunk.col_start.push_back(col_end);
+  };
+
+  // Add the entry for the named row, returning false if the value is
+  // invalid
+  auto addEntry = [&](const std::string& rowname, const char* value_begin,
+                      const char* value_end) {
+    auto mit = rowname2idx.find(rowname);
+    if (mit == rowname2idx.end()) {
+      addMessage(HighsLogType::kWarning,
+                 "Row name \"" + rowname +
+                     "\" in COLUMNS section is not defined: ignored\n");
+      return true;
+    }
+    word.assign(value_begin, value_end);
+    bool is_nan = false;
+    const double value = getValue(word, is_nan);
+    if (is_nan) {
+      addMessage(HighsLogType::kError,
+                 "Coefficient for column \"" + rowname + "\" is NaN\n");
+      chunk.status = Parsekey::kFail;
+      return false;
+    }
+    if (!value) return true;
+    const HighsInt rowidx = mit->second;
+    if (rowidx >= 0) {
+      chunk.index.push_back(rowidx);
+      chunk.value.push_back(value);
+    } else if (rowidx == -1) {
+      // Ignore duplicate entry
+      if (chunk.col_cost.back()) {
+        addMessage(HighsLogType::kWarning,
+                   "Column \"" + colname +
+                       "\" has duplicate nonzero in row \"" + objective_name +
+                       "\"\n");
+      } else {
+        chunk.col_cost.back() = value;
+      }
+    }
+    return true;
+  };
+
+  const char* line = chunk.begin;
+  while (line < chunk.end) {
+    const char* next = nextMpsLine(line, chunk.end);
+    const char *line_begin, *line_end;
+    const bool data_line = isMpsDataLine(line, next, line_begin, line_end);
+    line = next;
+    if (!data_line) continue;
+    if ((++num_line & 1023) == 0 && timeout()) {
+      chunk.status = Parsekey::kTimeout;
+      return;
+    }
+
+    const char* pos = line_begin;
+    const char *name_begin, *name_end, *marker_begin, *marker_end,
+        *value_begin, *value_end;
+    nextMpsWord(pos, line_end, name_begin, name_end);
+    nextMpsWord(pos, line_end, marker_begin, marker_end);
+    marker.assign(marker_begin, marker_end);
+
+    // check for integrality marker
+    if (marker == "'MARKER'") {
+      nextMpsWord(pos, line_end, value_begin, value_end);
+      marker.assign(value_begin, value_end);
+      const bool intorg = marker == "'INTORG'";
+      // The first marker is checked when the chunks are merged, and
+      // then the markers must alternate
+      bool valid;
+      if (!chunk.num_marker) {
+        valid = intorg || marker == "'INTEND'";
+        chunk.first_marker_is_intorg = intorg;
+        chunk.first_marker_message = chunk.message.size();
+      } else {
+        const bool expect_intorg =
+            chunk.first_marker_is_intorg == !(chunk.num_marker & 1);
+        valid = expect_intorg ? intorg : marker == "'INTEND'";
+      }
+      if (!valid) {
+        addMessage(HighsLogType::kError,
+                   "Integrality marker error in COLUMNS section of MPS file\n");
+        chunk.status = Parsekey::kFail;
+        return;
+      }
+      chunk.num_marker++;
+      marker_parity ^= 1;
+      continue;
+    }
+
+    // Detect whether the file is in fixed format with spaces in
+    // names, as in parseCols
+    if (marker_end - line_begin < 9 &&
+        rowname2idx.find(marker) == rowname2idx.end()) {
+      std::string name(line_begin,
+                       std::min(line_end - line_begin, std::ptrdiff_t{10}));
+      name = trim(name);
+      if (name.size() > 8) {
+        addMessage(HighsLogType::kError,
+                   "Row name \"" + name +
+                       "\" with spaces exceeds fixed format name length of "
+                       "8\n");
+        chunk.status = Parsekey::kFail;
+      } else {
+        addMessage(HighsLogType::kWarning,
+                   "Row name \"" + name + "\" with spaces has length " +
+                       std::to_string(name.size()) +
+                       ", so assume fixed format\n");
+        chunk.status = Parsekey::kFixedFormat;
+      }
+      return;
+    }
+
+    // Test for new column
+    if (colname.compare(0, std::string::npos, name_begin,
+                        name_end - name_begin) != 0) {
+      finishColumn();
+      colname.assign(name_begin, name_end);
+      chunk.col_name.push_back(colname);
+      chunk.col_cost.push_back(0);
+      chunk.col_marker_parity.push_back(marker_parity);
+    }
+
+    if (!nextMpsWord(pos, line_end, value_begin, value_end)) {
+      addMessage(HighsLogType::kError,
+                 "No coefficient given for column \"" + marker + "\"\n");
+      chunk.status = Parsekey::kFail;
+      return;
+    }
+    if (!addEntry(marker, value_begin, value_end)) return;
+
+    // parse second coefficient
+    if (!nextMpsWord(pos, line_end, marker_begin, marker_end)) continue;
+    marker.assign(marker_begin, marker_end);
+    nextMpsWord(pos, line_end, value_begin, value_end);
+    if (!addEntry(marker, value_begin, value_end)) return;
+  }
+  finishColumn();
+}
+
 HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
                                   std::istream& file) {
   std::string strline;
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
@@ -61,10 +62,17 @@ class HMpsFF {
                                          HighsModel& model);
 
   double time_limit = kHighsInf;
+  // Read the whole file into memory, memory-mapping it where
+  // possible, and parse the COLUMNS section in parallel
+  bool parallel_parse = false;
 
  private:
   double start_time;
 
+  // The file contents when parallel_parse is set
+  const char* buffer_begin = nullptr;
+  const char* buffer_end = nullptr;
+
   HighsInt num_row;
   HighsInt num_col;
   HighsInt num_nz;
@@ -185,6 +193,31 @@ class HMpsFF {
   std::unordered_map<std::string, int> rowname2idx;
   std::unordered_map<std::string, int> colname2idx;
 
+  // Columns parsed from a contiguous chunk of lines of the COLUMNS
+  // section by the parallel reader. Row names are resolved when the
+  // chunk is parsed, so the columns of all chunks can be merged into
+  // the constraint matrix with one column name lookup per column
+  struct ColumnsChunk {
+    const char* begin;
+    const char* end;
+    HMpsFF::Parsekey status = HMpsFF::Parsekey::kNone;
+    std::vector<std::string> col_name;
+    std::vector<HighsInt> col_start;
+    std::vector<double> col_cost;
+    // Parity of the number of integrality markers in the chunk before
+    // each column
+    std::vector<uint8_t> col_marker_parity;
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+    HighsInt num_marker = 0;
+    bool first_marker_is_intorg = false;
+    // Number of messages that precede the first integrality marker
+    size_t first_marker_message = 0;
+    // Messages are only logged when the chunks are merged, so that
+    // they appear in the order of the file
+    std::vector<std::pair<HighsLogType, std::string>> message;
+  };
+
   mutable std::string section_args;
 
   bool timeout();
@@ -192,9 +225,13 @@ class HMpsFF {
 
   FreeFormatParserReturnCode parse(const HighsLogOptions& log_options,
                                    const std::string& filename);
+  FreeFormatParserReturnCode parseSections(const HighsLogOptions& log_options,
+                                           std::istream& file);
   // Checks first word of strline and wraps it by it_begin and it_end
   HMpsFF::Parsekey checkFirstWord(std::string& strline, size_t& start,
                                   size_t& end, std::string& word) const;
+  // Identifies section keywords
+  HMpsFF::Parsekey getKeyword(const std::string& word) const;
 
   // Get index of column from column name, possibly adding new column
   // if no index is found
@@ -208,6 +245,9 @@ class HMpsFF {
                              std::istream& file);
   HMpsFF::Parsekey parseCols(const HighsLogOptions& log_options,
                              std::istream& file);
+  HMpsFF::Parsekey parseColsParallel(const HighsLogOptions& log_options,
+                                     std::istream& file);
+  void parseColumnsChunk(ColumnsChunk& chunk);
   HMpsFF::Parsekey parseRhs(const HighsLogOptions& log_options,
                             std::istream& file);
   HMpsFF::Parsekey parseRanges(const HighsLogOptions& log_options,
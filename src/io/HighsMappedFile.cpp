@@ -0,0 +1,78 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsMappedFile.cpp
+ * @brief
+ */
+#include "io/HighsMappedFile.h"
+
+#include <fstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef ZLIB_FOUND
+#include "../extern/zstr/zstr.hpp"
+#endif
+
+HighsMappedFile::~HighsMappedFile() {
+#ifndef _WIN32
+  if (mapped_) munmap(mapped_, size_);
+#endif
+}
+
+bool HighsMappedFile::open(const std::string& filename) {
+  const bool compressed =
+      filename.size() > 3 &&
+      filename.compare(filename.size() - 3, 3, ".gz") == 0;
+  if (!compressed && map(filename)) return true;
+#ifdef ZLIB_FOUND
+  zstr::ifstream f;
+  try {
+    f.open(filename.c_str(), std::ios::in);
+  } catch (const strict_fstream::Exception&) {
+    return false;
+  }
+#else
+  std::ifstream f(filename.c_str(), std::ios::in | std::ios::binary);
+#endif
+  if (!f.is_open()) return false;
+  std::vector<char> block(1 << 20);
+  while (f.read(block.data(), block.size()) || f.gcount() > 0)
+    buffer_.append(block.data(), f.gcount());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+  return true;
+}
+
+bool HighsMappedFile::map(const std::string& filename) {
+#ifdef _WIN32
+  return false;
+#else
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  void* mapped =
+      mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) return false;
+  mapped_ = mapped;
+  data_ = static_cast<const char*>(mapped);
+  size_ = file_stat.st_size;
+  return true;
+#endif
+}
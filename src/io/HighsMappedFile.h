@@ -0,0 +1,42 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsMappedFile.h
+ * @brief Read-only view of the contents of a file in memory
+ */
+#ifndef IO_HIGHS_MAPPED_FILE_H_
+#define IO_HIGHS_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+// Holds the contents of a file in memory. Uncompressed files are
+// memory-mapped where this is possible, otherwise the file is read
+// into a buffer. Files with the .gz extension are decompressed if
+// HiGHS is built with zlib
+class HighsMappedFile {
+ public:
+  HighsMappedFile() = default;
+  HighsMappedFile(const HighsMappedFile&) = delete;
+  HighsMappedFile& operator=(const HighsMappedFile&) = delete;
+  ~HighsMappedFile();
+
+  bool open(const std::string& filename);
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  bool map(const std::string& filename);
+
+  void* mapped_ = nullptr;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  std::string buffer_;
+};
+
+#endif
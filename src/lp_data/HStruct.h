@@ -151,6 +151,20 @@ struct HighsLinearObjective {
   void clear();
 };
 
+struct HighsLpDelta {
+  // Changes to the costs, column bounds and row bounds of an LP. In
+  // each case the indices must be strictly increasing
+  std::vector<HighsInt> cost_index;
+  std::vector<double> cost;
+  std::vector<HighsInt> col_index;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  std::vector<HighsInt> row_index;
+  std::vector<double> row_lower;
+  std::vector<double> row_upper;
+  void clear();
+};
+
 struct HighsSimplexStats {
   bool valid;
   HighsInt iteration_count;
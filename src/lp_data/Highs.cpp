@@ -11,6 +11,7 @@
 #include "Highs.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <csignal>
 #include <functional>
@@ -1555,7 +1556,9 @@ HighsStatus Highs::solve() {
             if (full_logging) options_.log_dev_level = kHighsLogDevLevelVerbose;
             // Force the use of simplex to clean up if IPM has been used
             // to solve the presolved problem
-            if (options_.solver == kIpmString) options_.solver = kSimplexString;
+            if (options_.solver == kIpmString ||
+                options_.solver == kConcurrentString)
+              options_.solver = kSimplexString;
             options_.simplex_strategy = kSimplexStrategyChoose;
             // Ensure that the parallel solver isn't used
             options_.simplex_min_concurrency = 1;
@@ -3272,6 +3275,165 @@ HighsStatus Highs::scaleRow(const HighsInt row, const double scale_value) {
   return returnFromHighs(return_status);
 }
 
+HighsStatus Highs::solveLpBatch(const std::vector<HighsLpDelta>& lp_delta,
+                                std::vector<HighsModelStatus>& model_status,
+                                std::vector<double>& objective_function_value,
+                                std::vector<HighsSolution>& solution,
+                                std::vector<HighsBasis>& basis) {
+  const HighsInt num_lp = lp_delta.size();
+  model_status.assign(num_lp, HighsModelStatus::kNotset);
+  objective_function_value.assign(num_lp, kHighsInf);
+  solution.assign(num_lp, HighsSolution());
+  basis.assign(num_lp, HighsBasis());
+  if (model_.isMip() || model_.isQp()) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "solveLpBatch: only available for LP\n");
+    return HighsStatus::kError;
+  }
+  const HighsLp& lp = model_.lp_;
+  // The changes are applied using the set interface, so the indices
+  // must be in range and strictly increasing
+  auto deltaSetOk = [](const std::vector<HighsInt>& set, const HighsInt dim,
+                       const size_t num_value0, const size_t num_value1) {
+    if (num_value0 != set.size() || num_value1 != set.size()) return false;
+    for (size_t k = 0; k < set.size(); k++) {
+      if (set[k] < 0 || set[k] >= dim) return false;
+      if (k > 0 && set[k] <= set[k - 1]) return false;
+    }
+    return true;
+  };
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+    const HighsLpDelta& delta = lp_delta[iLp];
+    if (!deltaSetOk(delta.cost_index, lp.num_col_, delta.cost.size(),
+                    delta.cost.size()) ||
+        !deltaSetOk(delta.col_index, lp.num_col_, delta.col_lower.size(),
+                    delta.col_upper.size()) ||
+        !deltaSetOk(delta.row_index, lp.num_row_, delta.row_lower.size(),
+                    delta.row_upper.size())) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "solveLpBatch: change %d has inconsistent sizes, or "
+                   "indices that are out of range or not strictly "
+                   "increasing\n",
+                   int(iLp));
+      return HighsStatus::kError;
+    }
+  }
+  if (num_lp == 0) return HighsStatus::kOk;
+
+  // All LPs are solved from the basis of the incumbent LP
+  if (!basis_.valid) {
+    HighsStatus call_status = run();
+    if (call_status == HighsStatus::kError || !basis_.valid) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "solveLpBatch: no basis for the incumbent LP\n");
+      return HighsStatus::kError;
+    }
+  }
+
+  highs::parallel::initialize_scheduler(options_.threads);
+  const HighsInt num_worker =
+      std::min(HighsInt{highs::parallel::num_threads()}, num_lp);
+
+  // Each worker solves LPs on its own copy of the incumbent LP. They
+  // run within the scheduler, so must not set the number of threads,
+  // and must not write to the log or files
+  HighsOptions worker_options = options_;
+  worker_options.solver = kSimplexString;
+  worker_options.threads = 0;
+  worker_options.output_flag = false;
+  worker_options.write_model_to_file = false;
+  worker_options.write_presolved_model_to_file = false;
+  worker_options.write_solution_to_file = false;
+  std::vector<std::unique_ptr<Highs>> worker(num_worker);
+  for (HighsInt iWorker = 0; iWorker < num_worker; iWorker++) {
+    worker[iWorker].reset(new Highs());
+    Highs& highs = *worker[iWorker];
+    highs.passOptions(worker_options);
+    highs.passModel(lp);
+    highs.setBasis(basis_);
+  }
+
+  std::vector<HighsStatus> run_status(num_lp, HighsStatus::kOk);
+  std::atomic<HighsInt> next_lp{0};
+  auto solveLps = [&](const HighsInt iWorker) {
+    Highs& highs = *worker[iWorker];
+    // Solving the incumbent LP from its optimal basis yields the
+    // invertible representation that is then the starting point for
+    // each LP, so the result for an LP does not depend on the worker
+    // that solves it
+    const bool have_iterate = highs.run() != HighsStatus::kError &&
+                              highs.putIterate() == HighsStatus::kOk;
+    std::vector<double> value0;
+    std::vector<double> value1;
+    for (HighsInt iLp = next_lp++; iLp < num_lp; iLp = next_lp++) {
+      const HighsLpDelta& delta = lp_delta[iLp];
+      const HighsInt num_cost = delta.cost_index.size();
+      const HighsInt num_col = delta.col_index.size();
+      const HighsInt num_row = delta.row_index.size();
+      if (num_cost)
+        highs.changeColsCost(num_cost, delta.cost_index.data(),
+                             delta.cost.data());
+      if (num_col)
+        highs.changeColsBounds(num_col, delta.col_index.data(),
+                               delta.col_lower.data(), delta.col_upper.data());
+      if (num_row)
+        highs.changeRowsBounds(num_row, delta.row_index.data(),
+                               delta.row_lower.data(), delta.row_upper.data());
+      if (have_iterate)
+        highs.getIterate();
+      else
+        highs.setBasis(basis_);
+      run_status[iLp] = highs.run();
+      model_status[iLp] = highs.getModelStatus();
+      objective_function_value[iLp] = highs.getInfo().objective_function_value;
+      solution[iLp] = highs.getSolution();
+      basis[iLp] = highs.getBasis();
+      // Restore the incumbent LP
+      if (num_cost) {
+        value0.resize(num_cost);
+        for (HighsInt k = 0; k < num_cost; k++)
+          value0[k] = lp.col_cost_[delta.cost_index[k]];
+        highs.changeColsCost(num_cost, delta.cost_index.data(), value0.data());
+      }
+      if (num_col) {
+        value0.resize(num_col);
+        value1.resize(num_col);
+        for (HighsInt k = 0; k < num_col; k++) {
+          value0[k] = lp.col_lower_[delta.col_index[k]];
+          value1[k] = lp.col_upper_[delta.col_index[k]];
+        }
+        highs.changeColsBounds(num_col, delta.col_index.data(), value0.data(),
+                               value1.data());
+      }
+      if (num_row) {
+        value0.resize(num_row);
+        value1.resize(num_row);
+        for (HighsInt k = 0; k < num_row; k++) {
+          value0[k] = lp.row_lower_[delta.row_index[k]];
+          value1[k] = lp.row_upper_[delta.row_index[k]];
+        }
+        highs.changeRowsBounds(num_row, delta.row_index.data(), value0.data(),
+                               value1.data());
+      }
+    }
+  };
+
+  highs::parallel::TaskGroup tg;
+  for (HighsInt iWorker = 1; iWorker < num_worker; iWorker++)
+    tg.spawn([&, iWorker]() { solveLps(iWorker); });
+  solveLps(0);
+  tg.taskWait();
+
+  HighsStatus return_status = HighsStatus::kOk;
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++)
+    if (run_status[iLp] != HighsStatus::kOk)
+      return_status = HighsStatus::kWarning;
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Solved batch of %d LPs using %d thread(s)\n", int(num_lp),
+               int(num_worker));
+  return return_status;
+}
+
 HighsStatus Highs::postsolve(const HighsSolution& solution) {
   HighsBasis basis;
   return this->postsolve(solution, basis);
@@ -3925,6 +3925,17 @@ HighsStatus Highs::multiobjectiveSolve() {
                                              original_lp_num_row);
 }
 
+void HighsLpDelta::clear() {
+  this->cost_index.clear();
+  this->cost.clear();
+  this->col_index.clear();
+  this->col_lower.clear();
+  this->col_upper.clear();
+  this->row_index.clear();
+  this->row_lower.clear();
+  this->row_upper.clear();
+}
+
 void HighsLinearObjective::clear() {
   this->weight = 0.0;
   this->offset = 0.0;
@@ -255,6 +255,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
 const string kPdlpString = "pdlp";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -356,6 +357,7 @@ struct HighsOptionsStruct {
   bool use_implied_bounds_from_presolve;
   bool lp_presolve_requires_basis_postsolve;
   bool mps_parser_type_free;
+  bool mps_parser_parallel;
   HighsInt keep_n_rows;
   HighsInt cost_scale_factor;
   HighsInt allowed_matrix_scale_factor;
@@ -373,6 +375,7 @@ struct HighsOptionsStruct {
   HighsInt presolve_rule_off;
   bool presolve_rule_logging;
   bool presolve_remove_slacks;
+  bool presolve_reuse;
   bool simplex_initial_condition_check;
   bool no_unnecessary_rebuild_refactor;
   double simplex_initial_condition_tolerance;
@@ -418,6 +421,10 @@ struct HighsOptionsStruct {
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  HighsInt mip_search_workers;
+  bool mip_search_deterministic;
+  HighsInt mip_strong_branching_threads;
+  bool mip_heuristic_worker;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
@@ -494,6 +501,7 @@ struct HighsOptionsStruct {
         use_implied_bounds_from_presolve(false),
         lp_presolve_requires_basis_postsolve(false),
         mps_parser_type_free(false),
+        mps_parser_parallel(false),
         keep_n_rows(0),
         cost_scale_factor(0),
         allowed_matrix_scale_factor(0),
@@ -511,6 +519,7 @@ struct HighsOptionsStruct {
         presolve_rule_off(0),
         presolve_rule_logging(false),
         presolve_remove_slacks(false),
+        presolve_reuse(false),
         simplex_initial_condition_check(false),
         no_unnecessary_rebuild_refactor(false),
         simplex_initial_condition_tolerance(0.0),
@@ -552,6 +561,10 @@ struct HighsOptionsStruct {
         mip_pool_soft_limit(0),
         mip_pscost_minreliable(0),
         mip_min_cliquetable_entries_for_parallelism(0),
+        mip_search_workers(0),
+        mip_search_deterministic(false),
+        mip_strong_branching_threads(0),
+        mip_heuristic_worker(false),
         mip_report_level(0),
         mip_feasibility_tolerance(0.0),
         mip_rel_gap(0.0),
@@ -633,10 +646,10 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_string = new OptionRecordString(
         kSolverString,
-        "Solver option: \"simplex\", \"choose\", \"ipm\" or \"pdlp\". If "
-        "\"simplex\"/\"ipm\"/\"pdlp\" is chosen then, for a MIP (QP) the "
-        "integrality "
-        "constraint (quadratic term) will be ignored",
+        "Solver option: \"simplex\", \"choose\", \"ipm\", \"pdlp\" or "
+        "\"concurrent\". If \"simplex\"/\"ipm\"/\"pdlp\"/\"concurrent\" is "
+        "chosen then, for a MIP (QP) the integrality constraint (quadratic "
+        "term) will be ignored",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -1029,6 +1042,34 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_search_workers",
+        "Number of workers exploring the MIP search tree concurrently (limited "
+        "by the number of threads)",
+        advanced, &mip_search_workers, 1, 1, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_search_deterministic",
+        "Whether concurrent MIP tree search workers update the shared search "
+        "data in a deterministic order",
+        advanced, &mip_search_deterministic, true);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "mip_strong_branching_threads",
+        "Number of strong branching LPs solved concurrently at a node of the "
+        "MIP search tree (limited by the number of threads)",
+        advanced, &mip_strong_branching_threads, 1, 1, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_heuristic_worker",
+        "Whether the sub-MIPs of the RENS and RINS heuristics are solved "
+        "asynchronously on a spare thread during the MIP search",
+        advanced, &mip_heuristic_worker, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             now_advanced, &mip_report_level, 0, 1, 2);
@@ -1174,6 +1215,13 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &mps_parser_type_free, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "mps_parser_parallel",
+        "Read the whole file into memory and parse the COLUMNS section in "
+        "parallel in the free format MPS file reader",
+        advanced, &mps_parser_parallel, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("keep_n_rows",
                             "For multiple N-rows in MPS files: delete rows / "
@@ -1339,6 +1387,13 @@ class HighsOptions : public HighsOptionsStruct {
                                        &presolve_remove_slacks, false);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "presolve_reuse",
+        "Restrict LP presolve to cost-independent reductions and reuse them "
+        "when only the costs of the LP change",
+        advanced, &presolve_reuse, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt(
         "presolve_substitution_maxfillin",
         "Maximal fillin allowed for substitutions in presolve", advanced,
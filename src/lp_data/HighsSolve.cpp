@@ -9,8 +9,13 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <memory>
+#include <mutex>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
+#include "parallel/HighsRaceTimer.h"
 #include "pdlp/CupdlpWrapper.h"
 #include "simplex/HApp.h"
 
@@ -42,6 +47,12 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
     return_status = interpretCallStatus(options.log_options, call_status,
                                         return_status, "solveUnconstrainedLp");
     if (return_status == HighsStatus::kError) return return_status;
+  } else if (options.solver == kConcurrentString) {
+    // Race simplex, IPX and PDLP
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
   } else if (options.solver == kIpmString || options.run_centring ||
              options.solver == kPdlpString) {
     // Use IPM or PDLP
@@ -211,6 +222,181 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+namespace {
+// Data for one of the solvers racing in solveLpConcurrent. Other than
+// the simplex solver, which uses the LP and HEkk instance of the
+// calling solver object, each solver works on its own copy of the LP
+struct ConcurrentLpSolver {
+  ConcurrentLpSolver(const HighsLpSolverObject& solver_object,
+                     const std::string& solver)
+      : basis(solver_object.basis_),
+        solution(solver_object.solution_),
+        info(solver_object.highs_info_),
+        options(solver_object.options_),
+        timer(solver_object.timer_) {
+    if (solver != kSimplexString) lp = solver_object.lp_;
+    options.solver = solver;
+    options.output_flag = false;
+    callback.clear();
+  }
+
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo info;
+  HEkk ekk_instance;
+  HighsCallback callback;
+  HighsOptions options;
+  HighsTimer timer;
+  HighsStatus status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double finish_time = kHighsInf;
+};
+
+void runConcurrentLpSolver(ConcurrentLpSolver& racer, HighsLp& lp,
+                           HEkk& ekk_instance,
+                           HighsRaceTimer<double>& race_timer,
+                           HighsCallback& user_callback,
+                           std::mutex& user_callback_mutex) {
+  // The solver is stopped via its interrupt callback once another
+  // solver has finished, and passes on the checks of any user
+  // interrupt callback
+  racer.callback.user_callback =
+      [&](int callback_type, const std::string& message,
+          const HighsCallbackDataOut* data_out, HighsCallbackDataIn* data_in,
+          void* user_callback_data) {
+        data_in->user_interrupt =
+            race_timer.limitReached(racer.timer.getWallTime());
+        if (data_in->user_interrupt) return;
+        std::lock_guard<std::mutex> lock(user_callback_mutex);
+        if (!user_callback.callbackActive(callback_type)) return;
+        user_callback.data_out = *data_out;
+        user_callback.clearHighsCallbackDataIn();
+        data_in->user_interrupt =
+            user_callback.callbackAction(callback_type, message);
+      };
+  racer.callback.active[kCallbackSimplexInterrupt] = true;
+  racer.callback.active[kCallbackIpmInterrupt] = true;
+  // No point in starting if another solver has already finished
+  if (race_timer.limitReached(racer.timer.getWallTime())) {
+    racer.model_status = HighsModelStatus::kInterrupt;
+    return;
+  }
+  HighsLpSolverObject racer_object(lp, racer.basis, racer.solution,
+                                   racer.info, ekk_instance, racer.callback,
+                                   racer.options, racer.timer);
+  try {
+    racer.status = solveLp(racer_object, "Concurrent " + racer.options.solver);
+  } catch (const std::exception& exception) {
+    highsLogDev(racer.options.log_options, HighsLogType::kError,
+                "Exception %s in concurrent %s solver\n", exception.what(),
+                racer.options.solver.c_str());
+    racer.status = HighsStatus::kError;
+  }
+  racer.model_status = racer_object.model_status_;
+  if (racer.status == HighsStatus::kError) return;
+  // A simplex solver only returns kUnboundedOrInfeasible when it has
+  // done all it can, whereas the other solvers would be worth waiting
+  // for
+  const bool finished =
+      racer.model_status == HighsModelStatus::kOptimal ||
+      racer.model_status == HighsModelStatus::kInfeasible ||
+      racer.model_status == HighsModelStatus::kUnbounded ||
+      racer.model_status == HighsModelStatus::kInterrupt ||
+      (racer.model_status == HighsModelStatus::kUnboundedOrInfeasible &&
+       racer.options.solver == kSimplexString);
+  if (!finished) return;
+  racer.finish_time = racer.timer.getWallTime();
+  race_timer.decreaseLimit(racer.finish_time);
+}
+}  // namespace
+
+// Races the simplex, IPX and PDLP solvers - as far as there are
+// threads for them - returning the result of the first to finish
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  const std::vector<std::string> solvers = {kSimplexString, kIpmString,
+                                            kPdlpString};
+  const HighsInt num_racer =
+      std::min(HighsInt(solvers.size()),
+               HighsInt(std::max(highs::parallel::num_threads(), 1)));
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent LP solver racing %d solver%s\n", int(num_racer),
+               num_racer > 1 ? "s" : "");
+
+  std::vector<std::unique_ptr<ConcurrentLpSolver>> racers;
+  for (HighsInt iRacer = 0; iRacer < num_racer; iRacer++)
+    racers.emplace_back(new ConcurrentLpSolver(solver_object, solvers[iRacer]));
+
+  HighsRaceTimer<double> race_timer;
+  std::mutex user_callback_mutex;
+  HEkk& ekk_instance = solver_object.ekk_instance_;
+  {
+    highs::parallel::TaskGroup tg;
+    // Spawn in order of preference, since the first spawned tasks are
+    // the first to be stolen by idle workers
+    for (HighsInt iRacer = 1; iRacer < num_racer; iRacer++) {
+      ConcurrentLpSolver& racer = *racers[iRacer];
+      tg.spawn([&]() {
+        runConcurrentLpSolver(racer, racer.lp, racer.ekk_instance, race_timer,
+                              solver_object.callback_, user_callback_mutex);
+      });
+    }
+    runConcurrentLpSolver(*racers[0], solver_object.lp_, ekk_instance,
+                          race_timer, solver_object.callback_,
+                          user_callback_mutex);
+    tg.taskWait();
+  }
+  // Solving the LP with simplex will have pointed its HEkk instance
+  // at the data of the racing solver
+  ekk_instance.setPointers(&solver_object.callback_, &solver_object.options_,
+                           &solver_object.timer_);
+
+  // The winner is the first solver to have finished. If none has
+  // finished, take the simplex result as for a simplex-only solve
+  HighsInt winner = 0;
+  for (HighsInt iRacer = 1; iRacer < num_racer; iRacer++)
+    if (racers[iRacer]->finish_time < racers[winner]->finish_time)
+      winner = iRacer;
+  // The simplex data are no longer consistent with the basis of any
+  // other solver
+  if (winner != 0) ekk_instance.invalidate();
+
+  ConcurrentLpSolver& result = *racers[winner];
+  HighsInfo& highs_info = solver_object.highs_info_;
+  HighsInfo initial_info = highs_info;
+  highs_info = result.info;
+  // Accumulate the iterations performed by all the solvers
+  highs_info.simplex_iteration_count = initial_info.simplex_iteration_count;
+  highs_info.ipm_iteration_count = initial_info.ipm_iteration_count;
+  highs_info.crossover_iteration_count =
+      initial_info.crossover_iteration_count;
+  highs_info.pdlp_iteration_count = initial_info.pdlp_iteration_count;
+  for (HighsInt iRacer = 0; iRacer < num_racer; iRacer++) {
+    const HighsInfo& info = racers[iRacer]->info;
+    highs_info.simplex_iteration_count +=
+        info.simplex_iteration_count - initial_info.simplex_iteration_count;
+    highs_info.ipm_iteration_count +=
+        info.ipm_iteration_count - initial_info.ipm_iteration_count;
+    highs_info.crossover_iteration_count +=
+        info.crossover_iteration_count -
+        initial_info.crossover_iteration_count;
+    highs_info.pdlp_iteration_count +=
+        info.pdlp_iteration_count - initial_info.pdlp_iteration_count;
+  }
+  solver_object.basis_ = std::move(result.basis);
+  solver_object.solution_ = std::move(result.solution);
+  solver_object.model_status_ = result.model_status;
+
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent LP solver: %s solver %s with model status %s\n",
+               result.options.solver.c_str(),
+               result.finish_time < kHighsInf ? "finished first"
+                                              : "did not finish",
+               utilModelStatusToString(result.model_status).c_str());
+  return result.status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
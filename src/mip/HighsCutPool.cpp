@@ -116,6 +116,11 @@ double HighsCutPool::getParallelism(HighsInt row1, HighsInt row2) const {
 }
 
 void HighsCutPool::lpCutRemoved(HighsInt cut) {
+  if (numLpCopies_[cut] > 0) {
+    // the cut is still part of another LP relaxation
+    --numLpCopies_[cut];
+    return;
+  }
   if (matrix_.columnsLinked(cut)) {
     propRows.erase(std::make_pair(-1, cut));
     propRows.emplace(1, cut);
@@ -495,6 +500,7 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
   if (rowindex == int(rhs_.size())) {
     rhs_.resize(rowindex + 1);
     ages_.resize(rowindex + 1);
+    numLpCopies_.resize(rowindex + 1);
     rownormalization_.resize(rowindex + 1);
     maxabscoef_.resize(rowindex + 1);
     rowintegral.resize(rowindex + 1);
@@ -503,6 +509,7 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
   // set the right hand side and reset the age
   rhs_[rowindex] = rhs;
   ages_[rowindex] = std::max(HighsInt{0}, agelim_ - 5);
+  numLpCopies_[rowindex] = 0;
   ++ageDistribution[ages_[rowindex]];
   rowintegral[rowindex] = integral;
   if (propagate) propRows.emplace(ages_[rowindex], rowindex);
@@ -8,6 +8,7 @@
 #ifndef HIGHS_CUTPOOL_H_
 #define HIGHS_CUTPOOL_H_
 
+#include <cassert>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -53,6 +54,7 @@ class HighsCutPool {
   HighsDynamicRowMatrix matrix_;
   std::vector<double> rhs_;
   std::vector<int16_t> ages_;
+  std::vector<HighsInt> numLpCopies_;
   std::vector<double> rownormalization_;
   std::vector<double> maxabscoef_;
   std::vector<uint8_t> rowintegral;
@@ -110,6 +112,13 @@ class HighsCutPool {
 
   void lpCutRemoved(HighsInt cut);
 
+  // register an additional LP relaxation holding a cut that is already in an LP,
+  // so that the cut is only released once it is removed from all of them
+  void lpCutShared(HighsInt cut) {
+    assert(ages_[cut] < 0);
+    ++numLpCopies_[cut];
+  }
+
   void addPropagationDomain(HighsDomain::CutpoolPropagation* domain) {
     propagationDomains.push_back(domain);
   }
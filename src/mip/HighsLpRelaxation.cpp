@@ -13,6 +13,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsMipSolver.h"
 #include "mip/HighsMipSolverData.h"
+#include "mip/HighsMipWorker.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/MipTimer.h"
 #include "util/HighsCDouble.h"
@@ -181,6 +182,8 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   objective = -kHighsInf;
   currentbasisstored = false;
   adjustSymBranchingCol = true;
+  workerTurnstile = nullptr;
+  workerId = 0;
   row_ep.size = 0;
 }
 
@@ -206,6 +209,8 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsLpRelaxation& other)
   maxNumFractional = 0;
   lastAgeCall = 0;
   objective = -kHighsInf;
+  workerTurnstile = nullptr;
+  workerId = 0;
   row_ep.size = 0;
 }
 
@@ -551,6 +556,14 @@ void HighsLpRelaxation::removeCuts(HighsInt ndelcuts,
   }
 }
 
+void HighsLpRelaxation::shareCutsWithPool() {
+  HighsInt nlprows = lpsolver.getNumRow();
+  for (HighsInt i = mipsolver.numRow(); i != nlprows; ++i) {
+    if (lprows[i].origin == LpRow::Origin::kCutPool)
+      mipsolver.mipdata_->cutpool.lpCutShared(lprows[i].index);
+  }
+}
+
 void HighsLpRelaxation::removeCuts() {
   assert(lpsolver.getLp().num_row_ ==
          (HighsInt)lpsolver.getLp().row_lower_.size());
@@ -1042,10 +1055,19 @@ void HighsLpRelaxation::setObjectiveLimit(double objlim) {
   lpsolver.setOptionValue("objective_bound", objlim + offset);
 }
 
-HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
+HighsStatus HighsLpRelaxation::runLpSolver() {
   lpsolver.setOptionValue(
       "time_limit", lpsolver.getRunTime() + mipsolver.options_mip_->time_limit -
                         mipsolver.timer_.read(mipsolver.timer_.total_clock));
+  // the LP solve only touches this relaxation, so other tree search workers
+  // may access the shared MIP data in the meantime
+  if (workerTurnstile) workerTurnstile->release(workerId);
+  HighsStatus callstatus = lpsolver.run();
+  if (workerTurnstile) workerTurnstile->acquire(workerId);
+  return callstatus;
+}
+
+HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
   // lpsolver.setOptionValue("output_flag", true);
   const bool valid_basis = lpsolver.getBasis().valid;
   const HighsInt simplex_solve_clock = valid_basis
@@ -1072,9 +1094,14 @@ HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
   }
 
   mipsolver.analysis_.mipTimerStart(simplex_solve_clock);
-  HighsStatus callstatus = lpsolver.run();
+  HighsStatus callstatus = runLpSolver();
   mipsolver.analysis_.mipTimerStop(simplex_solve_clock);
 
+  return getRunStatus(callstatus, resolve_on_error);
+}
+
+HighsLpRelaxation::Status HighsLpRelaxation::getRunStatus(
+    HighsStatus callstatus, bool resolve_on_error) {
   const HighsInfo& info = lpsolver.getInfo();
   HighsInt itercount = std::max(HighsInt{0}, info.simplex_iteration_count);
   numlpiters += itercount;
@@ -17,6 +17,7 @@
 class HighsDomain;
 struct HighsCutSet;
 class HighsPseudocost;
+class HighsMipWorkerTurnstile;
 
 class HighsLpRelaxation {
  public:
@@ -81,6 +82,8 @@ class HighsLpRelaxation {
   HighsInt maxNumFractional;
   Status status;
   bool adjustSymBranchingCol;
+  HighsMipWorkerTurnstile* workerTurnstile;
+  HighsInt workerId;
 
   void storeDualInfProof();
 
@@ -165,6 +168,17 @@ class HighsLpRelaxation {
     this->adjustSymBranchingCol = adjustSymBranchingCol;
   }
 
+  /// let other search workers pass the turnstile while this LP is solved
+  void setWorkerTurnstile(HighsMipWorkerTurnstile* workerTurnstile,
+                          HighsInt workerId) {
+    this->workerTurnstile = workerTurnstile;
+    this->workerId = workerId;
+  }
+
+  /// register the cuts of this LP copy with the cut pool so that they are not
+  /// released before every LP containing them has removed them
+  void shareCutsWithPool();
+
   void resetToGlobalDomain();
 
   void computeBasicDegenerateDuals(double threshold,
@@ -335,6 +349,13 @@ class HighsLpRelaxation {
 
   Status run(bool resolve_on_error = true);
 
+  /// run the LP solver without processing the result, which only accesses
+  /// this relaxation so that copies of it can be solved concurrently
+  HighsStatus runLpSolver();
+
+  /// process the result of runLpSolver() as done by run()
+  Status getRunStatus(HighsStatus callstatus, bool resolve_on_error);
+
   Highs& getLpSolver() { return lpsolver; }
   const Highs& getLpSolver() const { return lpsolver; }
 
@@ -15,10 +15,12 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "mip/HighsMipWorker.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
 #include "mip/HighsSeparation.h"
 #include "mip/MipTimer.h"
+#include "parallel/HighsParallel.h"
 #include "presolve/HPresolve.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "presolve/PresolveComponent.h"
@@ -27,6 +29,103 @@
 
 using std::fabs;
 
+namespace {
+// Compares the estimated size of the search tree with the number of nodes
+// explored so far to decide whether restarting the search from the root node
+// is worthwhile
+struct TreeSizeRestartCheck {
+  HighsInt numHugeTreeEstim;
+  int64_t numNodesLastCheck;
+  int64_t nextCheck;
+  double treeweightLastCheck;
+  double upperLimLastCheck;
+  double lowerBoundLastCheck;
+
+  explicit TreeSizeRestartCheck(const HighsMipSolverData& mipdata)
+      : numHugeTreeEstim(0),
+        numNodesLastCheck(mipdata.num_nodes),
+        nextCheck(mipdata.num_nodes),
+        treeweightLastCheck(0.0),
+        upperLimLastCheck(mipdata.upper_limit),
+        lowerBoundLastCheck(mipdata.lower_bound) {}
+
+  bool restartRequired(HighsMipSolverData& mipdata,
+                       const HighsOptions& options) {
+    if (mipdata.num_nodes < nextCheck) return false;
+
+    auto nTreeRestarts = mipdata.numRestarts - mipdata.numRestartsRoot;
+    double currNodeEstim =
+        numNodesLastCheck - mipdata.num_nodes_before_run +
+        (mipdata.num_nodes - numNodesLastCheck) *
+            double(1.0 - mipdata.pruned_treeweight) /
+            std::max(
+                double(mipdata.pruned_treeweight - treeweightLastCheck),
+                mipdata.epsilon);
+    // printf(
+    //     "nTreeRestarts: %d, numNodesThisRun: %ld, numNodesLastCheck: %ld,
+    //     " "currNodeEstim: %g, " "prunedTreeWeightDelta: %g,
+    //     numHugeTreeEstim: %d, numLeavesThisRun:
+    //     "
+    //     "%ld\n",
+    //     nTreeRestarts, mipdata.num_nodes -
+    //     mipdata.num_nodes_before_run, numNodesLastCheck -
+    //     mipdata.num_nodes_before_run, currNodeEstim, 100.0 *
+    //     double(mipdata.pruned_treeweight - treeweightLastCheck),
+    //     numHugeTreeEstim,
+    //     mipdata.num_leaves - mipdata.num_leaves_before_run);
+
+    bool doRestart = false;
+
+    double activeIntegerRatio =
+        1.0 - mipdata.percentageInactiveIntegers() / 100.0;
+    activeIntegerRatio *= activeIntegerRatio;
+
+    if (!doRestart) {
+      double gapReduction = 1.0;
+      if (mipdata.upper_limit != kHighsInf) {
+        double oldGap = upperLimLastCheck - lowerBoundLastCheck;
+        double newGap = mipdata.upper_limit - mipdata.lower_bound;
+        gapReduction = oldGap / newGap;
+      }
+
+      if (gapReduction < 1.0 + (0.05 / activeIntegerRatio) &&
+          currNodeEstim >=
+              activeIntegerRatio * 20 *
+                  (mipdata.num_nodes - mipdata.num_nodes_before_run)) {
+        nextCheck = mipdata.num_nodes + 100;
+        ++numHugeTreeEstim;
+      } else {
+        numHugeTreeEstim = 0;
+        treeweightLastCheck = double(mipdata.pruned_treeweight);
+        numNodesLastCheck = mipdata.num_nodes;
+        upperLimLastCheck = mipdata.upper_limit;
+        lowerBoundLastCheck = mipdata.lower_bound;
+      }
+
+      // Possibly prevent restart - necessary for debugging presolve
+      // errors: see #1553
+      if (options.mip_allow_restart) {
+        int64_t minHugeTreeOffset =
+            (mipdata.num_leaves - mipdata.num_leaves_before_run) / 1000;
+        int64_t minHugeTreeEstim = HighsIntegers::nearestInteger(
+            activeIntegerRatio * (10 + minHugeTreeOffset) *
+            std::pow(1.5, nTreeRestarts));
+
+        doRestart = numHugeTreeEstim >= minHugeTreeEstim;
+      } else {
+        doRestart = false;
+      }
+    } else {
+      // count restart due to many fixings within the first 1000 nodes as
+      // root restart
+      ++mipdata.numRestartsRoot;
+    }
+
+    return doRestart;
+  }
+};
+}  // namespace
+
 HighsMipSolver::HighsMipSolver(HighsCallback& callback,
                                const HighsOptions& options, const HighsLp& lp,
                                const HighsSolution& solution, bool submip,
@@ -214,6 +313,16 @@ restart:
     return;
   }
 
+  if (!submip && !analysis_.analyse_mip_time) {
+    HighsInt numWorkers = std::min(options_mip_->mip_search_workers,
+                                   HighsInt{highs::parallel::num_threads()});
+    if (numWorkers > 1) {
+      if (runParallelSearch(numWorkers)) goto restart;
+      cleanupSolve();
+      return;
+    }
+  }
+
   std::shared_ptr<const HighsBasis> basis;
   HighsSearch search{*this, mipdata_->pseudocost};
   mipdata_->debugSolution.registerDomain(search.getLocalDomain());
@@ -237,14 +346,13 @@ restart:
   int64_t numStallNodes = 0;
   int64_t lastLbLeave = 0;
   int64_t numQueueLeaves = 0;
-  HighsInt numHugeTreeEstim = 0;
-  int64_t numNodesLastCheck = mipdata_->num_nodes;
-  int64_t nextCheck = mipdata_->num_nodes;
-  double treeweightLastCheck = 0.0;
-  double upperLimLastCheck = mipdata_->upper_limit;
-  double lowerBoundLastCheck = mipdata_->lower_bound;
+  TreeSizeRestartCheck restartCheck(*mipdata_);
+  mipdata_->heuristics.enableAsyncSubMips(options_mip_->mip_heuristic_worker);
   analysis_.mipTimerStart(kMipClockSearch);
   while (search.hasNode()) {
+    // pass back the result of a sub-MIP that was solved on another thread
+    mipdata_->heuristics.pollAsyncSubMip();
+
     analysis_.mipTimerStart(kMipClockPerformAging1);
     mipdata_->conflictPool.performAging();
     analysis_.mipTimerStop(kMipClockPerformAging1);
@@ -428,83 +536,16 @@ restart:
       analysis_.mipTimerStop(kMipClockUpdateLocalDomain);
     }
 
-    if (!submip && mipdata_->num_nodes >= nextCheck) {
-      auto nTreeRestarts = mipdata_->numRestarts - mipdata_->numRestartsRoot;
-      double currNodeEstim =
-          numNodesLastCheck - mipdata_->num_nodes_before_run +
-          (mipdata_->num_nodes - numNodesLastCheck) *
-              double(1.0 - mipdata_->pruned_treeweight) /
-              std::max(
-                  double(mipdata_->pruned_treeweight - treeweightLastCheck),
-                  mipdata_->epsilon);
-      // printf(
-      //     "nTreeRestarts: %d, numNodesThisRun: %ld, numNodesLastCheck: %ld,
-      //     " "currNodeEstim: %g, " "prunedTreeWeightDelta: %g,
-      //     numHugeTreeEstim: %d, numLeavesThisRun:
-      //     "
-      //     "%ld\n",
-      //     nTreeRestarts, mipdata_->num_nodes -
-      //     mipdata_->num_nodes_before_run, numNodesLastCheck -
-      //     mipdata_->num_nodes_before_run, currNodeEstim, 100.0 *
-      //     double(mipdata_->pruned_treeweight - treeweightLastCheck),
-      //     numHugeTreeEstim,
-      //     mipdata_->num_leaves - mipdata_->num_leaves_before_run);
-
-      bool doRestart = false;
-
-      double activeIntegerRatio =
-          1.0 - mipdata_->percentageInactiveIntegers() / 100.0;
-      activeIntegerRatio *= activeIntegerRatio;
-
-      if (!doRestart) {
-        double gapReduction = 1.0;
-        if (mipdata_->upper_limit != kHighsInf) {
-          double oldGap = upperLimLastCheck - lowerBoundLastCheck;
-          double newGap = mipdata_->upper_limit - mipdata_->lower_bound;
-          gapReduction = oldGap / newGap;
-        }
-
-        if (gapReduction < 1.0 + (0.05 / activeIntegerRatio) &&
-            currNodeEstim >=
-                activeIntegerRatio * 20 *
-                    (mipdata_->num_nodes - mipdata_->num_nodes_before_run)) {
-          nextCheck = mipdata_->num_nodes + 100;
-          ++numHugeTreeEstim;
-        } else {
-          numHugeTreeEstim = 0;
-          treeweightLastCheck = double(mipdata_->pruned_treeweight);
-          numNodesLastCheck = mipdata_->num_nodes;
-          upperLimLastCheck = mipdata_->upper_limit;
-          lowerBoundLastCheck = mipdata_->lower_bound;
-        }
-
-        // Possibly prevent restart - necessary for debugging presolve
-        // errors: see #1553
-        if (options_mip_->mip_allow_restart) {
-          int64_t minHugeTreeOffset =
-              (mipdata_->num_leaves - mipdata_->num_leaves_before_run) / 1000;
-          int64_t minHugeTreeEstim = HighsIntegers::nearestInteger(
-              activeIntegerRatio * (10 + minHugeTreeOffset) *
-              std::pow(1.5, nTreeRestarts));
-
-          doRestart = numHugeTreeEstim >= minHugeTreeEstim;
-        } else {
-          doRestart = false;
-        }
-      } else {
-        // count restart due to many fixings within the first 1000 nodes as
-        // root restart
-        ++mipdata_->numRestartsRoot;
-      }
-
-      if (doRestart) {
-        highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
-                     "\nRestarting search from the root node\n");
-        mipdata_->performRestart();
-        analysis_.mipTimerStop(kMipClockSearch);
-        goto restart;
-      }
-    }  // if (!submip && mipdata_->num_nodes >= nextCheck))
+    if (!submip && restartCheck.restartRequired(*mipdata_, *options_mip_)) {
+      // the solution of a pending sub-MIP refers to the current model
+      mipdata_->heuristics.finishAsyncSubMip();
+      mipdata_->heuristics.enableAsyncSubMips(false);
+      highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                   "\nRestarting search from the root node\n");
+      mipdata_->performRestart();
+      analysis_.mipTimerStop(kMipClockSearch);
+      goto restart;
+    }
 
     // remove the iteration limit when installing a new node
     // mipdata_->lp.setIterationLimit();
@@ -658,10 +699,137 @@ restart:
     if (limit_reached) break;
   }  // while(search.hasNode())
   analysis_.mipTimerStop(kMipClockSearch);
+  mipdata_->heuristics.finishAsyncSubMip();
+  mipdata_->heuristics.enableAsyncSubMips(false);
 
   cleanupSolve();
 }
 
+bool HighsMipSolver::runParallelSearch(HighsInt numWorkers) {
+  HighsMipWorkerTurnstile turnstile(numWorkers,
+                                    options_mip_->mip_search_deterministic);
+  std::vector<std::unique_ptr<HighsMipWorker>> workers;
+  workers.reserve(numWorkers);
+  for (HighsInt i = 0; i != numWorkers; ++i)
+    workers.emplace_back(new HighsMipWorker(*this, turnstile, i));
+
+  highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+               "Exploring the search tree with %" HIGHSINT_FORMAT
+               " %s workers\n",
+               numWorkers,
+               options_mip_->mip_search_deterministic ? "deterministic"
+                                                      : "opportunistic");
+
+  double prev_lower_bound = mipdata_->lower_bound;
+
+  mipdata_->lower_bound = mipdata_->nodequeue.getBestLowerBound();
+
+  bool bound_change = mipdata_->lower_bound != prev_lower_bound;
+  if (bound_change)
+    mipdata_->updatePrimalDualIntegral(prev_lower_bound, mipdata_->lower_bound,
+                                       mipdata_->upper_bound,
+                                       mipdata_->upper_bound);
+
+  mipdata_->printDisplayLine();
+
+  HighsMipWorkerSharedState state;
+  TreeSizeRestartCheck restartCheck(*mipdata_);
+  analysis_.mipTimerStart(kMipClockSearch);
+  while (true) {
+    // the workers take nodes from the shared queue until the node limit of
+    // the round is reached. Global information is only processed in between
+    // the rounds while no worker has a node installed
+    state.nodeLimit = mipdata_->num_nodes + 100 * numWorkers;
+    turnstile.reset();
+    {
+      highs::parallel::TaskGroup tg;
+      for (HighsInt i = 1; i < numWorkers; ++i)
+        tg.spawn([&, i]() { workers[i]->run(state); });
+      workers[0]->run(state);
+      tg.taskWait();
+    }
+
+    if (state.limitReached) {
+      double prev_lower_bound = mipdata_->lower_bound;
+
+      mipdata_->lower_bound = std::min(mipdata_->upper_bound,
+                                       mipdata_->nodequeue.getBestLowerBound());
+
+      bool bound_change = mipdata_->lower_bound != prev_lower_bound;
+      if (bound_change)
+        mipdata_->updatePrimalDualIntegral(
+            prev_lower_bound, mipdata_->lower_bound, mipdata_->upper_bound,
+            mipdata_->upper_bound);
+      mipdata_->printDisplayLine();
+      break;
+    }
+
+    // propagate the global domain
+    mipdata_->domain.propagate();
+    mipdata_->pruned_treeweight += mipdata_->nodequeue.pruneInfeasibleNodes(
+        mipdata_->domain, mipdata_->feastol);
+
+    // if global propagation detected infeasibility, stop here
+    if (mipdata_->domain.infeasible()) {
+      mipdata_->nodequeue.clear();
+      mipdata_->pruned_treeweight = 1.0;
+
+      double prev_lower_bound = mipdata_->lower_bound;
+
+      mipdata_->lower_bound = std::min(kHighsInf, mipdata_->upper_bound);
+
+      bool bound_change = mipdata_->lower_bound != prev_lower_bound;
+      if (bound_change)
+        mipdata_->updatePrimalDualIntegral(
+            prev_lower_bound, mipdata_->lower_bound, mipdata_->upper_bound,
+            mipdata_->upper_bound);
+      mipdata_->printDisplayLine();
+      break;
+    }
+
+    double prev_lower_bound = mipdata_->lower_bound;
+
+    mipdata_->lower_bound = std::min(mipdata_->upper_bound,
+                                     mipdata_->nodequeue.getBestLowerBound());
+    bool bound_change = mipdata_->lower_bound != prev_lower_bound;
+    if (bound_change)
+      mipdata_->updatePrimalDualIntegral(
+          prev_lower_bound, mipdata_->lower_bound, mipdata_->upper_bound,
+          mipdata_->upper_bound);
+    mipdata_->printDisplayLine();
+    if (mipdata_->nodequeue.empty()) break;
+
+    // if global propagation found bound changes, we update the local domains
+    if (!mipdata_->domain.getChangedCols().empty()) {
+      highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+                  "added %" HIGHSINT_FORMAT " global bound changes\n",
+                  (HighsInt)mipdata_->domain.getChangedCols().size());
+      mipdata_->cliquetable.cleanupFixed(mipdata_->domain);
+      for (HighsInt col : mipdata_->domain.getChangedCols())
+        mipdata_->implications.cleanupVarbounds(col);
+
+      mipdata_->domain.setDomainChangeStack(std::vector<HighsDomainChange>());
+      for (auto& worker : workers) worker->resetLocalDomain();
+
+      mipdata_->domain.clearChangedCols();
+      mipdata_->removeFixedIndices();
+    }
+
+    if (restartCheck.restartRequired(*mipdata_, *options_mip_)) {
+      highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                   "\nRestarting search from the root node\n");
+      // the workers need to release their cuts before the restart
+      workers.clear();
+      mipdata_->performRestart();
+      analysis_.mipTimerStop(kMipClockSearch);
+      return true;
+    }
+  }
+  analysis_.mipTimerStop(kMipClockSearch);
+
+  return false;
+}
+
 void HighsMipSolver::cleanupSolve() {
   // Force a final logging line
   mipdata_->printDisplayLine(kSolutionSourceCleanup);
@@ -96,6 +96,7 @@ class HighsMipSolver {
 
   mutable HighsTimer timer_;
   void cleanupSolve();
+  bool runParallelSearch(HighsInt numWorkers);
 
   void runPresolve(const HighsInt presolve_reduction_limit);
   const HighsLp& getPresolvedModel() const;
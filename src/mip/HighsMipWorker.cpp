@@ -0,0 +1,282 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipWorker.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "mip/HighsMipSolverData.h"
+
+HighsMipWorkerTurnstile::HighsMipWorkerTurnstile(HighsInt numWorkers,
+                                                 bool deterministic)
+    : active(numWorkers, 1),
+      turn(0),
+      locked(false),
+      deterministic(deterministic) {}
+
+HighsInt HighsMipWorkerTurnstile::nextActiveWorker(HighsInt worker) const {
+  const HighsInt numWorkers = active.size();
+  for (HighsInt i = 1; i <= numWorkers; ++i) {
+    HighsInt next = (worker + i) % numWorkers;
+    if (active[next]) return next;
+  }
+  return -1;
+}
+
+void HighsMipWorkerTurnstile::reset() {
+  std::lock_guard<std::mutex> lg(mutex);
+  std::fill(active.begin(), active.end(), 1);
+  turn = 0;
+  locked = false;
+}
+
+void HighsMipWorkerTurnstile::acquire(HighsInt worker) {
+  std::unique_lock<std::mutex> lg(mutex);
+  if (deterministic)
+    turnChanged.wait(lg, [&]() { return turn == worker; });
+  else {
+    turnChanged.wait(lg, [&]() { return !locked; });
+    locked = true;
+  }
+}
+
+void HighsMipWorkerTurnstile::release(HighsInt worker) {
+  {
+    std::lock_guard<std::mutex> lg(mutex);
+    if (deterministic) {
+      assert(turn == worker);
+      turn = nextActiveWorker(worker);
+    } else
+      locked = false;
+  }
+  turnChanged.notify_all();
+}
+
+void HighsMipWorkerTurnstile::leave(HighsInt worker) {
+  {
+    std::lock_guard<std::mutex> lg(mutex);
+    active[worker] = 0;
+    if (deterministic) {
+      assert(turn == worker);
+      turn = nextActiveWorker(worker);
+    } else
+      locked = false;
+  }
+  turnChanged.notify_all();
+}
+
+HighsMipWorker::HighsMipWorker(HighsMipSolver& mipsolver,
+                               HighsMipWorkerTurnstile& turnstile,
+                               HighsInt workerId)
+    : mipsolver(mipsolver),
+      turnstile(turnstile),
+      workerId(workerId),
+      lp(mipsolver.mipdata_->lp),
+      search(mipsolver, mipsolver.mipdata_->pseudocost),
+      sepa(mipsolver),
+      plungeNodes(0) {
+  // the copied LP holds the same cuts as the LP of the MIP solver
+  lp.shareCutsWithPool();
+  lp.setWorkerTurnstile(&turnstile, workerId);
+  mipsolver.mipdata_->debugSolution.registerDomain(search.getLocalDomain());
+  search.setLpRelaxation(&lp);
+  sepa.setLpRelaxation(&lp);
+}
+
+HighsMipWorker::~HighsMipWorker() { lp.removeCuts(); }
+
+void HighsMipWorker::flushStatistics() {
+  search.flushStatistics();
+  mipsolver.mipdata_->heuristics.flushStatistics();
+}
+
+bool HighsMipWorker::installNextNode(HighsMipWorkerSharedState& state) {
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+
+  while (!mipdata.nodequeue.empty()) {
+    assert(!search.hasNode());
+
+    if (state.numQueueLeaves - state.lastLbLeave >= 10) {
+      search.installNode(mipdata.nodequeue.popBestBoundNode());
+      state.lastLbLeave = state.numQueueLeaves;
+    } else {
+      HighsInt bestBoundNodeStackSize =
+          mipdata.nodequeue.getBestBoundDomchgStackSize();
+      double bestBoundNodeLb = mipdata.nodequeue.getBestLowerBound();
+      HighsNodeQueue::OpenNode nextNode(mipdata.nodequeue.popBestNode());
+      if (nextNode.lower_bound == bestBoundNodeLb &&
+          (HighsInt)nextNode.domchgstack.size() == bestBoundNodeStackSize)
+        state.lastLbLeave = state.numQueueLeaves;
+      search.installNode(std::move(nextNode));
+    }
+
+    ++state.numQueueLeaves;
+
+    if (search.getCurrentEstimate() >= mipdata.upper_limit) {
+      ++state.numStallNodes;
+      if (mipsolver.options_mip_->mip_max_stall_nodes != kHighsIInf &&
+          state.numStallNodes >= mipsolver.options_mip_->mip_max_stall_nodes) {
+        // keep the node in the queue so that the lower bound remains valid
+        search.openNodesToQueue(mipdata.nodequeue);
+        state.limitReached = true;
+        state.stop = true;
+        mipsolver.modelstatus_ = HighsModelStatus::kSolutionLimit;
+        return false;
+      }
+    } else
+      state.numStallNodes = 0;
+
+    assert(search.hasNode());
+
+    // evaluate the node before separating it, as it may be fathomed due to
+    // global information found by the other workers
+    if (search.evaluateNode() == HighsSearch::NodeResult::kSubOptimal)
+      search.currentNodeToQueue(mipdata.nodequeue);
+
+    if (search.currentNodePruned()) {
+      search.backtrack();
+      ++mipdata.num_leaves;
+      ++mipdata.num_nodes;
+      search.flushStatistics();
+
+      // global bound changes are only applied to the local domains of the
+      // workers in between the rounds of the search. The node queue is not
+      // pruned here: it derives global bounds from the open nodes, which is
+      // only valid while no other worker has a node installed
+      mipdata.domain.propagate();
+
+      if (mipdata.domain.infeasible()) {
+        state.stop = true;
+        return false;
+      }
+
+      if (mipdata.checkLimits()) {
+        state.limitReached = true;
+        state.stop = true;
+        return false;
+      }
+
+      if (mipdata.num_nodes >= state.nodeLimit) return false;
+
+      continue;
+    }
+
+    // the node is still not fathomed, so perform separation
+    sepa.separate(search.getLocalDomain());
+
+    if (mipdata.domain.infeasible()) {
+      search.cutoffNode();
+      search.openNodesToQueue(mipdata.nodequeue);
+      state.stop = true;
+      return false;
+    }
+
+    // after separation we store the new basis and plunge from this node
+    if (lp.getStatus() != HighsLpRelaxation::Status::kError &&
+        lp.getStatus() != HighsLpRelaxation::Status::kNotSet)
+      lp.storeBasis();
+
+    std::shared_ptr<const HighsBasis> basis = lp.getStoredBasis();
+    if (!basis || !isBasisConsistent(lp.getLp(), *basis)) {
+      HighsBasis b = mipdata.firstrootbasis;
+      b.row_status.resize(lp.numRows(), HighsBasisStatus::kBasic);
+      basis = std::make_shared<const HighsBasis>(std::move(b));
+      lp.setStoredBasis(basis);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void HighsMipWorker::plunge(HighsMipWorkerSharedState& state) {
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+
+  mipdata.conflictPool.performAging();
+
+  HighsInt iterlimit =
+      10 * std::max(lp.getAvgSolveIters(), mipdata.avgrootlpiters);
+  iterlimit = std::max({HighsInt{10000}, iterlimit,
+                        HighsInt((3 * mipdata.firstrootlpiters) / 2)});
+  lp.setIterationLimit(iterlimit);
+
+  plungeNodes = 0;
+  bool considerHeuristics = true;
+  while (true) {
+    if (considerHeuristics && mipdata.moreHeuristicsAllowed()) {
+      if (search.evaluateNode() == HighsSearch::NodeResult::kSubOptimal) break;
+
+      if (search.currentNodePruned()) {
+        ++mipdata.num_leaves;
+        plungeNodes += search.getLocalNodes();
+        search.flushStatistics();
+      } else {
+        const std::vector<double>& lpsol =
+            lp.getLpSolver().getSolution().col_value;
+        if (mipdata.incumbent.empty())
+          mipdata.heuristics.randomizedRounding(lpsol);
+
+        if (mipdata.incumbent.empty())
+          mipdata.heuristics.RENS(lpsol);
+        else
+          mipdata.heuristics.RINS(lpsol);
+
+        mipdata.heuristics.flushStatistics();
+      }
+    }
+
+    considerHeuristics = false;
+
+    if (mipdata.domain.infeasible()) break;
+
+    if (!search.currentNodePruned()) {
+      if (search.dive() == HighsSearch::NodeResult::kSubOptimal) break;
+
+      ++mipdata.num_leaves;
+
+      plungeNodes += search.getLocalNodes();
+      search.flushStatistics();
+    }
+
+    if (mipdata.checkLimits()) {
+      state.limitReached = true;
+      state.stop = true;
+      break;
+    }
+
+    if (plungeNodes >= 100) break;
+
+    if (!search.backtrackPlunge(mipdata.nodequeue)) break;
+
+    assert(search.hasNode());
+
+    if (mipdata.conflictPool.getNumConflicts() >
+        mipsolver.options_mip_->mip_pool_soft_limit)
+      mipdata.conflictPool.performAging();
+
+    plungeNodes += search.getLocalNodes();
+    search.flushStatistics();
+    mipdata.printDisplayLine();
+  }
+
+  search.openNodesToQueue(mipdata.nodequeue);
+  flushStatistics();
+}
+
+void HighsMipWorker::run(HighsMipWorkerSharedState& state) {
+  turnstile.acquire(workerId);
+
+  while (!state.stop && mipsolver.mipdata_->num_nodes < state.nodeLimit) {
+    if (!installNextNode(state)) break;
+    plunge(state);
+  }
+
+  assert(!search.hasNode());
+  turnstile.leave(workerId);
+}
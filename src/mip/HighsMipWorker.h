@@ -0,0 +1,101 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef HIGHS_MIP_WORKER_H_
+#define HIGHS_MIP_WORKER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "mip/HighsLpRelaxation.h"
+#include "mip/HighsSearch.h"
+#include "mip/HighsSeparation.h"
+
+class HighsMipSolver;
+
+/// Serialises the access of the tree search workers to the shared MIP data,
+/// i.e. the node queue, the cut and conflict pools, the global domain, the
+/// pseudocosts and the incumbent. A worker holds the turnstile while it works
+/// on a node and only passes it on while its LP relaxation is solved. In
+/// deterministic mode the turnstile is passed between the workers in a fixed
+/// round robin order, so that the sequence of updates to the shared data does
+/// not depend on the timing of the LP solves.
+class HighsMipWorkerTurnstile {
+  std::mutex mutex;
+  std::condition_variable turnChanged;
+  std::vector<uint8_t> active;
+  HighsInt turn;
+  bool locked;
+  bool deterministic;
+
+  HighsInt nextActiveWorker(HighsInt worker) const;
+
+ public:
+  HighsMipWorkerTurnstile(HighsInt numWorkers, bool deterministic);
+
+  /// make all workers active again with the turn at the first worker
+  void reset();
+
+  void acquire(HighsInt worker);
+
+  void release(HighsInt worker);
+
+  /// release the turnstile and drop out of the round robin order
+  void leave(HighsInt worker);
+};
+
+/// Search state shared between the workers. It must only be accessed while
+/// holding the turnstile
+struct HighsMipWorkerSharedState {
+  int64_t numStallNodes = 0;
+  int64_t lastLbLeave = 0;
+  int64_t numQueueLeaves = 0;
+  // no further nodes are taken from the queue once this many nodes have been
+  // explored so that the global data can be updated
+  int64_t nodeLimit = 0;
+  bool stop = false;
+  bool limitReached = false;
+};
+
+/// A tree search worker owns its own LP relaxation, local domain and
+/// separation, and explores plunges starting from nodes of the shared node
+/// queue. New incumbents, cuts, conflicts and pseudocost observations are
+/// published to the shared data of the MIP solver.
+class HighsMipWorker {
+  HighsMipSolver& mipsolver;
+  HighsMipWorkerTurnstile& turnstile;
+  HighsInt workerId;
+  HighsLpRelaxation lp;
+  HighsSearch search;
+  HighsSeparation sepa;
+  int64_t plungeNodes;
+
+  bool installNextNode(HighsMipWorkerSharedState& state);
+
+  void plunge(HighsMipWorkerSharedState& state);
+
+  void flushStatistics();
+
+ public:
+  HighsMipWorker(HighsMipSolver& mipsolver, HighsMipWorkerTurnstile& turnstile,
+                 HighsInt workerId);
+
+  ~HighsMipWorker();
+
+  HighsMipWorker(const HighsMipWorker&) = delete;
+  HighsMipWorker& operator=(const HighsMipWorker&) = delete;
+
+  void resetLocalDomain() { search.resetLocalDomain(); }
+
+  /// explore plunges until the node limit of the round is reached, the node
+  /// queue is empty or the search is stopped
+  void run(HighsMipWorkerSharedState& state);
+};
+
+#endif
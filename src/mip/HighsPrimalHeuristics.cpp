@@ -7,6 +7,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsPrimalHeuristics.h"
 
+#include <atomic>
 #include <numeric>
 #include <unordered_set>
 
@@ -19,6 +20,7 @@
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/MipTimer.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsHash.h"
 #include "util/HighsIntegers.h"
 
@@ -32,19 +34,58 @@
 #define FP_32BIT_VOLATILE
 #endif
 
+// A sub-MIP that is solved as a task on a spare thread while the search
+// continues. The sub-MIP is initialized from copies of the data of the MIP
+// solver, since the search keeps changing them.
+struct HighsPrimalHeuristics::AsyncSubMip {
+  HighsOptions options;
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsPseudocostInitialization pscostinit;
+  HighsCliqueTable cliquetable;
+  HighsImplications implications;
+  double fixingRate;
+  std::unique_ptr<HighsMipSolver> solver;
+  std::atomic<bool> finished;
+  // declared last, so that the task is synced before the data it uses is
+  // destroyed
+  highs::parallel::TaskGroup taskGroup;
+
+  AsyncSubMip(const HighsMipSolver& mipsolver, HighsOptions&& options,
+              HighsLp&& lp, const HighsBasis& basis, double fixingRate)
+      : options(std::move(options)),
+        lp(std::move(lp)),
+        basis(basis),
+        pscostinit(mipsolver.mipdata_->pseudocost, 1),
+        cliquetable(mipsolver.numCol()),
+        implications(mipsolver.mipdata_->implications),
+        fixingRate(fixingRate),
+        finished(false) {
+    // the clique table cannot be copied, but building it from the table of
+    // the MIP solver only keeps what the sub-MIP would take from it anyway
+    cliquetable.buildFrom(&this->lp, mipsolver.mipdata_->cliquetable);
+    solution.value_valid = false;
+    solution.dual_valid = false;
+  }
+};
+
 HighsPrimalHeuristics::HighsPrimalHeuristics(HighsMipSolver& mipsolver)
     : mipsolver(mipsolver),
       total_repair_lp(0),
       total_repair_lp_feasible(0),
       total_repair_lp_iterations(0),
       lp_iterations(0),
-      randgen(mipsolver.options_mip_->random_seed) {
+      randgen(mipsolver.options_mip_->random_seed),
+      asyncSubMipsEnabled(false) {
   successObservations = 0;
   numSuccessObservations = 0;
   infeasObservations = 0;
   numInfeasObservations = 0;
 }
 
+HighsPrimalHeuristics::~HighsPrimalHeuristics() = default;
+
 void HighsPrimalHeuristics::setupIntCols() {
   intcols = mipsolver.mipdata_->integer_cols;
 
@@ -79,12 +120,12 @@ void HighsPrimalHeuristics::setupIntCols() {
   });
 }
 
-bool HighsPrimalHeuristics::solveSubMip(
-    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
-    std::vector<double> colLower, std::vector<double> colUpper,
-    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
-  HighsOptions submipoptions = *mipsolver.options_mip_;
-  HighsLp submip = lp;
+void HighsPrimalHeuristics::setupSubMip(
+    const HighsLp& lp, std::vector<double> colLower,
+    std::vector<double> colUpper, HighsInt maxleaves, HighsInt maxnodes,
+    HighsInt stallnodes, HighsOptions& submipoptions, HighsLp& submip) const {
+  submipoptions = *mipsolver.options_mip_;
+  submip = lp;
 
   // set bounds and restore integrality of the lp relaxation copy
   submip.col_lower_ = std::move(colLower);
@@ -129,21 +170,10 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.presolve = "on";
   submipoptions.mip_detect_symmetry = false;
   submipoptions.mip_heuristic_effort = 0.8;
-  // setup solver and run it
+}
 
-  HighsSolution solution;
-  solution.value_valid = false;
-  solution.dual_valid = false;
-  // Create HighsMipSolver instance for sub-MIP
-  HighsMipSolver submipsolver(*mipsolver.callback_, submipoptions, submip,
-                              solution, true, mipsolver.submip_level + 1);
-  submipsolver.rootbasis = &basis;
-  HighsPseudocostInitialization pscostinit(mipsolver.mipdata_->pseudocost, 1);
-  submipsolver.pscostinit = &pscostinit;
-  submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
-  submipsolver.implicinit = &mipsolver.mipdata_->implications;
-  // Solve the sub-MIP
-  submipsolver.run();
+bool HighsPrimalHeuristics::processSubMipResult(
+    const HighsMipSolver& submipsolver, double fixingRate) {
   mipsolver.max_submip_level =
       std::max(submipsolver.max_submip_level + 1, mipsolver.max_submip_level);
   if (submipsolver.mipdata_) {
@@ -186,6 +216,78 @@ bool HighsPrimalHeuristics::solveSubMip(
   return true;
 }
 
+bool HighsPrimalHeuristics::solveSubMip(
+    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
+    std::vector<double> colLower, std::vector<double> colUpper,
+    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+  HighsOptions submipoptions;
+  HighsLp submip;
+  setupSubMip(lp, std::move(colLower), std::move(colUpper), maxleaves,
+              maxnodes, stallnodes, submipoptions, submip);
+
+  if (asyncSubMipsEnabled) pollAsyncSubMip();
+  if (asyncSubMipsEnabled && !asyncSubMip) {
+    // hand the sub-MIP to a spare thread and continue the search, its result
+    // is passed back by pollAsyncSubMip() or finishAsyncSubMip()
+    asyncSubMip.reset(new AsyncSubMip(mipsolver, std::move(submipoptions),
+                                      std::move(submip), basis, fixingRate));
+    AsyncSubMip& task = *asyncSubMip;
+    task.solver.reset(new HighsMipSolver(*mipsolver.callback_, task.options,
+                                         task.lp, task.solution, true,
+                                         mipsolver.submip_level + 1));
+    task.solver->rootbasis = &task.basis;
+    task.solver->pscostinit = &task.pscostinit;
+    task.solver->clqtableinit = &task.cliquetable;
+    task.solver->implicinit = &task.implications;
+    task.taskGroup.spawn([&task]() {
+      task.solver->run();
+      task.finished.store(true, std::memory_order_release);
+    });
+    return true;
+  }
+
+  // setup solver and run it
+  HighsSolution solution;
+  solution.value_valid = false;
+  solution.dual_valid = false;
+  // Create HighsMipSolver instance for sub-MIP
+  HighsMipSolver submipsolver(*mipsolver.callback_, submipoptions, submip,
+                              solution, true, mipsolver.submip_level + 1);
+  submipsolver.rootbasis = &basis;
+  HighsPseudocostInitialization pscostinit(mipsolver.mipdata_->pseudocost, 1);
+  submipsolver.pscostinit = &pscostinit;
+  submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
+  submipsolver.implicinit = &mipsolver.mipdata_->implications;
+  // Solve the sub-MIP
+  submipsolver.run();
+  return processSubMipResult(submipsolver, fixingRate);
+}
+
+void HighsPrimalHeuristics::enableAsyncSubMips(bool enable) {
+  // the task of an asynchronous sub-MIP is spawned on the deque of the
+  // calling thread, so this must only be enabled in the serial tree search
+  // where the same thread also collects the results
+  asyncSubMipsEnabled = enable && !mipsolver.submip &&
+                        highs::parallel::num_threads() > 1;
+}
+
+void HighsPrimalHeuristics::completeAsyncSubMip() {
+  asyncSubMip->taskGroup.sync();
+  processSubMipResult(*asyncSubMip->solver, asyncSubMip->fixingRate);
+  asyncSubMip.reset();
+  flushStatistics();
+}
+
+void HighsPrimalHeuristics::pollAsyncSubMip() {
+  if (asyncSubMip && asyncSubMip->finished.load(std::memory_order_acquire))
+    completeAsyncSubMip();
+}
+
+void HighsPrimalHeuristics::finishAsyncSubMip() {
+  // if no other thread picked up the task, sync() solves the sub-MIP here
+  if (asyncSubMip) completeAsyncSubMip();
+}
+
 double HighsPrimalHeuristics::determineTargetFixingRate() {
   double lowFixingRate = 0.6;
   double highFixingRate = 0.6;
@@ -8,6 +8,7 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <memory>
 #include <vector>
 
 #include "lp_data/HStruct.h"
@@ -15,6 +16,7 @@
 #include "util/HighsRandom.h"
 
 class HighsMipSolver;
+class HighsOptions;
 
 class HighsPrimalHeuristics {
  private:
@@ -33,11 +35,33 @@ class HighsPrimalHeuristics {
 
   std::vector<HighsInt> intcols;
 
+  struct AsyncSubMip;
+  std::unique_ptr<AsyncSubMip> asyncSubMip;
+  bool asyncSubMipsEnabled;
+
+  void setupSubMip(const HighsLp& lp, std::vector<double> colLower,
+                   std::vector<double> colUpper, HighsInt maxleaves,
+                   HighsInt maxnodes, HighsInt stallnodes,
+                   HighsOptions& submipoptions, HighsLp& submip) const;
+
+  bool processSubMipResult(const HighsMipSolver& submipsolver,
+                           double fixingRate);
+
+  void completeAsyncSubMip();
+
  public:
   HighsPrimalHeuristics(HighsMipSolver& mipsolver);
 
+  ~HighsPrimalHeuristics();
+
   void setupIntCols();
 
+  void enableAsyncSubMips(bool enable);
+
+  void pollAsyncSubMip();
+
+  void finishAsyncSubMip();
+
   bool solveSubMip(const HighsLp& lp, const HighsBasis& basis,
                    double fixingRate, std::vector<double> colLower,
                    std::vector<double> colUpper, HighsInt maxleaves,
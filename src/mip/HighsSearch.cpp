@@ -7,12 +7,14 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsSearch.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "lp_data/HConst.h"
 #include "mip/HighsCutGeneration.h"
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 
 HighsSearch::HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost)
     : mipsolver(mipsolver),
@@ -238,6 +240,146 @@ void HighsSearch::addInfeasibleConflict() {
   }
 }
 
+HighsInt HighsSearch::getStrongBranchingThreads() const {
+  HighsInt sbThreads = mipsolver.options_mip_->mip_strong_branching_threads;
+  // the clocks of the MIP timer cannot be used by several threads
+  if (sbThreads <= 1 || mipsolver.analysis_.analyse_mip_time) return 1;
+  return std::min(sbThreads, HighsInt(highs::parallel::num_threads()));
+}
+
+void HighsSearch::getChildLpBounds(std::vector<HighsInt>& cols,
+                                   std::vector<double>& lower,
+                                   std::vector<double>& upper) const {
+  // bound changes of continuous columns are not passed to the LP, see
+  // HighsLpRelaxation::flushDomain()
+  cols.clear();
+  lower.clear();
+  upper.clear();
+  for (HighsInt col : localdom.getChangedCols()) {
+    if (mipsolver.variableType(col) == HighsVarType::kContinuous) continue;
+    cols.push_back(col);
+    lower.push_back(localdom.col_lower_[col]);
+    upper.push_back(localdom.col_upper_[col]);
+  }
+}
+
+void HighsSearch::solveStrongBranchingLps(
+    std::vector<StrongBranchingLp>& sbLps,
+    const std::vector<HighsDomainChange>& branchings) {
+  // the copies are created from the LP relaxation of the node, so it must
+  // contain all bound changes of the local domain
+  lp->flushDomain(localdom);
+  const HighsLp& nodeLp = lp->getLpSolver().getLp();
+
+  for (StrongBranchingLp& sbLp : sbLps) sbLp.solved = false;
+
+  // set up the child nodes serially, children that are infeasible after
+  // propagation are detected again when their branch is evaluated
+  HighsInt numLps = 0;
+  for (const HighsDomainChange& domchg : branchings) {
+    bool orbitalFixing =
+        nodestack.back().stabilizerOrbits && orbitsValidInChildNode(domchg);
+    localdom.changeBound(domchg);
+    localdom.propagate();
+
+    if (!localdom.infeasible()) {
+      if (orbitalFixing)
+        nodestack.back().stabilizerOrbits->orbitalFixing(localdom);
+      else
+        mipsolver.mipdata_->symmetries.propagateOrbitopes(localdom);
+    }
+
+    if (!localdom.infeasible()) {
+      if (numLps == (HighsInt)sbLps.size()) {
+        sbLps.emplace_back();
+        sbLps.back().lp.reset(new HighsLpRelaxation(*lp));
+        sbLps.back().lp->shareCutsWithPool();
+      }
+      StrongBranchingLp& sbLp = sbLps[numLps++];
+
+      // reset the bounds of the child solved previously to the node bounds
+      HighsInt numCols = sbLp.cols.size();
+      if (numCols != 0) {
+        for (HighsInt i = 0; i < numCols; ++i) {
+          sbLp.lower[i] = nodeLp.col_lower_[sbLp.cols[i]];
+          sbLp.upper[i] = nodeLp.col_upper_[sbLp.cols[i]];
+        }
+        sbLp.lp->getLpSolver().changeColsBounds(
+            numCols, sbLp.cols.data(), sbLp.lower.data(), sbLp.upper.data());
+      }
+
+      sbLp.branching = domchg;
+      getChildLpBounds(sbLp.cols, sbLp.lower, sbLp.upper);
+      sbLp.lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+    }
+
+    localdom.backtrack();
+    localdom.clearChangedCols();
+  }
+
+  highs::parallel::for_each(0, numLps, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; ++i) {
+      StrongBranchingLp& sbLp = sbLps[i];
+      Highs& lpsolver = sbLp.lp->getLpSolver();
+      sbLp.numIters = 0;
+
+      if (!sbLp.iterateStored) {
+        // solve the LP of the node once to obtain the iterate from which the
+        // LPs of the children are started
+        sbLp.callstatus = sbLp.lp->runLpSolver();
+        sbLp.numIters +=
+            std::max(HighsInt{0}, lpsolver.getInfo().simplex_iteration_count);
+        if (sbLp.callstatus == HighsStatus::kError ||
+            lpsolver.putIterate() != HighsStatus::kOk)
+          continue;
+        sbLp.iterateStored = true;
+      }
+
+      lpsolver.changeColsBounds(sbLp.cols.size(), sbLp.cols.data(),
+                                sbLp.lower.data(), sbLp.upper.data());
+      lpsolver.getIterate();
+      sbLp.callstatus = sbLp.lp->runLpSolver();
+      sbLp.numIters +=
+          std::max(HighsInt{0}, lpsolver.getInfo().simplex_iteration_count);
+      sbLp.solved = true;
+    }
+  });
+
+  // the results are processed serially and in a fixed order, since this may
+  // add to the clique table
+  for (HighsInt i = 0; i < numLps; ++i) {
+    StrongBranchingLp& sbLp = sbLps[i];
+    lpiterations += sbLp.numIters;
+    sblpiterations += sbLp.numIters;
+    if (sbLp.solved)
+      sbLp.status = sbLp.lp->getRunStatus(sbLp.callstatus, false);
+  }
+}
+
+HighsSearch::StrongBranchingLp* HighsSearch::getSolvedStrongBranchingLp(
+    std::vector<StrongBranchingLp>& sbLps, const HighsDomainChange& branching,
+    bool checkBounds) {
+  for (StrongBranchingLp& sbLp : sbLps) {
+    if (!sbLp.solved || sbLp.branching != branching) continue;
+    if (!checkBounds) return &sbLp;
+
+    // the result can only be used if the child node is still the same, which
+    // may not be the case when conflicts or global bounds were found since the
+    // LP was solved
+    sbLp.solved = false;
+    std::vector<HighsInt> cols;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    getChildLpBounds(cols, lower, upper);
+    if (cols == sbLp.cols && lower == sbLp.lower && upper == sbLp.upper)
+      return &sbLp;
+
+    return nullptr;
+  }
+
+  return nullptr;
+}
+
 HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
                                                double& downNodeLb,
                                                double& upNodeLb) {
@@ -386,8 +528,75 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     return best;
   };
 
+  auto evalDownBranch = [&](HighsInt k) {
+    HighsInt col = fracints[k].first;
+    return !downscorereliable[k] &&
+           (upscorereliable[k] ||
+            std::make_pair(downscore[k],
+                           pseudocost.getAvgInferencesDown(col)) >=
+                std::make_pair(upscore[k], pseudocost.getAvgInferencesUp(col)));
+  };
+
+  auto getBranching = [&](HighsInt k, bool upbranch) {
+    HighsInt col = fracints[k].first;
+    double fracval = fracints[k].second;
+    return upbranch
+               ? HighsDomainChange{std::ceil(fracval), col,
+                                   HighsBoundType::kLower}
+               : HighsDomainChange{std::floor(fracval), col,
+                                   HighsBoundType::kUpper};
+  };
+
   HighsLpRelaxation::Playground playground = lp->playground();
 
+  // with a thread budget the LPs of several unreliable branches are solved
+  // concurrently on copies of the LP relaxation, starting with the branch that
+  // is evaluated next and continuing with the candidates of the best
+  // pseudocost scores. The results are analysed in the order of the serial
+  // evaluation
+  const HighsInt sbThreads = getStrongBranchingThreads();
+  std::vector<StrongBranchingLp> sbLps;
+
+  auto solveStrongBranchingBatch = [&](HighsInt candidate, bool upbranch) {
+    std::vector<HighsDomainChange> branchings;
+    auto addBranchings = [&](HighsInt k, bool upbranch) {
+      if ((HighsInt)branchings.size() < sbThreads &&
+          !(upbranch ? upscorereliable[k] : downscorereliable[k]))
+        branchings.push_back(getBranching(k, upbranch));
+      if ((HighsInt)branchings.size() < sbThreads &&
+          !(upbranch ? downscorereliable[k] : upscorereliable[k]))
+        branchings.push_back(getBranching(k, !upbranch));
+    };
+
+    addBranchings(candidate, upbranch);
+
+    std::vector<std::pair<double, HighsInt>> candidates;
+    for (HighsInt k : evalqueue) {
+      if (k == candidate || (upscorereliable[k] && downscorereliable[k]))
+        continue;
+      candidates.emplace_back(
+          -pseudocost.getScore(fracints[k].first, fracints[k].second), k);
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& scoredCandidate : candidates) {
+      if ((HighsInt)branchings.size() >= sbThreads) break;
+      HighsInt k = scoredCandidate.second;
+      addBranchings(k, !evalDownBranch(k));
+    }
+
+    solveStrongBranchingLps(sbLps, branchings);
+  };
+
+  // points lp back to the LP relaxation of the node after the result of a
+  // strong branching LP solved on a copy has been analysed, the objective of
+  // the node is always taken from the LP relaxation of the node
+  struct NodeLpGuard {
+    HighsLpRelaxation*& lp;
+    HighsLpRelaxation* nodeLp;
+    ~NodeLpGuard() { lp = nodeLp; }
+  };
+
   while (true) {
     bool mustStop = getStrongBranchingLpIterations() >= maxSbIters ||
                     mipsolver.mipdata_->checkLimits();
@@ -527,12 +736,14 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
       }
     };
 
-    if (!downscorereliable[candidate] &&
-        (upscorereliable[candidate] ||
-         std::make_pair(downscore[candidate],
-                        pseudocost.getAvgInferencesDown(col)) >=
-             std::make_pair(upscore[candidate],
-                            pseudocost.getAvgInferencesUp(col)))) {
+    NodeLpGuard nodeLpGuard{lp, lp};
+    const bool evalDown = evalDownBranch(candidate);
+    if (sbThreads > 1 &&
+        !getSolvedStrongBranchingLp(
+            sbLps, getBranching(candidate, !evalDown), false))
+      solveStrongBranchingBatch(candidate, !evalDown);
+
+    if (evalDown) {
       // evaluate down branch
       // if (!mipsolver.submip)
       //   printf("down eval col=%d fracval=%g\n", col, fracval);
@@ -568,11 +779,19 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
 
       pseudocost.addInferenceObservation(col, inferences, false);
 
-      int64_t numiters = lp->getNumLpIterations();
-      HighsLpRelaxation::Status status = playground.solveLp(localdom);
-      numiters = lp->getNumLpIterations() - numiters;
-      lpiterations += numiters;
-      sblpiterations += numiters;
+      HighsLpRelaxation::Status status;
+      StrongBranchingLp* sbLp = getSolvedStrongBranchingLp(sbLps, domchg, true);
+      if (sbLp) {
+        // the LP of the child was already solved, analyse the copy below
+        status = sbLp->status;
+        lp = sbLp->lp.get();
+      } else {
+        int64_t numiters = lp->getNumLpIterations();
+        status = playground.solveLp(localdom);
+        numiters = lp->getNumLpIterations() - numiters;
+        lpiterations += numiters;
+        sblpiterations += numiters;
+      }
 
       if (lp->scaledOptimal(status)) {
         lp->performAging();
@@ -582,7 +801,8 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
         const std::vector<double>& sol = lp->getSolution().col_value;
         double solobj = checkSol(sol, integerfeasible);
 
-        double objdelta = std::max(solobj - lp->getObjective(), 0.0);
+        double objdelta =
+            std::max(solobj - nodeLpGuard.nodeLp->getObjective(), 0.0);
         if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
 
         downscore[candidate] = objdelta;
@@ -700,11 +920,19 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
 
       pseudocost.addInferenceObservation(col, inferences, true);
 
-      int64_t numiters = lp->getNumLpIterations();
-      HighsLpRelaxation::Status status = playground.solveLp(localdom);
-      numiters = lp->getNumLpIterations() - numiters;
-      lpiterations += numiters;
-      sblpiterations += numiters;
+      HighsLpRelaxation::Status status;
+      StrongBranchingLp* sbLp = getSolvedStrongBranchingLp(sbLps, domchg, true);
+      if (sbLp) {
+        // the LP of the child was already solved, analyse the copy below
+        status = sbLp->status;
+        lp = sbLp->lp.get();
+      } else {
+        int64_t numiters = lp->getNumLpIterations();
+        status = playground.solveLp(localdom);
+        numiters = lp->getNumLpIterations() - numiters;
+        lpiterations += numiters;
+        sblpiterations += numiters;
+      }
 
       if (lp->scaledOptimal(status)) {
         lp->performAging();
@@ -716,7 +944,8 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
             lp->getLpSolver().getSolution().col_value;
         double solobj = checkSol(sol, integerfeasible);
 
-        double objdelta = std::max(solobj - lp->getObjective(), 0.0);
+        double objdelta =
+            std::max(solobj - nodeLpGuard.nodeLp->getObjective(), 0.0);
         if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
 
         upscore[candidate] = objdelta;
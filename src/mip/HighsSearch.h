@@ -9,6 +9,7 @@
 #define HIGHS_SEARCH_H_
 
 #include <cstdint>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -137,6 +138,48 @@ class HighsSearch {
 
   bool orbitsValidInChildNode(const HighsDomainChange& branchChg) const;
 
+  // copy of the LP relaxation of a node on which the strong branching LP of
+  // one branch is solved concurrently with the LPs of other branches
+  struct StrongBranchingLp {
+    std::unique_ptr<HighsLpRelaxation> lp;
+    HighsDomainChange branching;
+    // bounds of the integral columns in the child node that were passed to
+    // the LP
+    std::vector<HighsInt> cols;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    HighsStatus callstatus;
+    HighsLpRelaxation::Status status;
+    int64_t numIters;
+    bool iterateStored;
+    bool solved;
+
+    StrongBranchingLp()
+        : branching{0.0, -1, HighsBoundType::kLower},
+          callstatus(HighsStatus::kOk),
+          status(HighsLpRelaxation::Status::kNotSet),
+          numIters(0),
+          iterateStored(false),
+          solved(false) {}
+    StrongBranchingLp(StrongBranchingLp&& other) = default;
+    ~StrongBranchingLp() {
+      if (lp) lp->removeCuts();
+    }
+  };
+
+  HighsInt getStrongBranchingThreads() const;
+
+  void getChildLpBounds(std::vector<HighsInt>& cols, std::vector<double>& lower,
+                        std::vector<double>& upper) const;
+
+  void solveStrongBranchingLps(
+      std::vector<StrongBranchingLp>& sbLps,
+      const std::vector<HighsDomainChange>& branchings);
+
+  StrongBranchingLp* getSolvedStrongBranchingLp(
+      std::vector<StrongBranchingLp>& sbLps, const HighsDomainChange& branching,
+      bool checkBounds);
+
  public:
   HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost);
 
@@ -11,6 +11,8 @@
  */
 #include "pdlp/CupdlpWrapper.h"
 
+#include "parallel/HighsParallel.h"
+
 void getUserParamsFromOptions(const HighsOptions& options,
                               cupdlp_bool* ifChangeIntParam,
                               cupdlp_int* intParam,
@@ -20,6 +22,37 @@ void getUserParamsFromOptions(const HighsOptions& options,
 void analysePdlpSolution(const HighsOptions& options, const HighsLp& lp,
                          const HighsSolution& highs_solution);
 
+struct CupdlpInterruptData {
+  HighsCallback* callback;
+  bool interrupted;
+};
+
+// cuPDLP-C is interrupted via the IPM interrupt callback, and checks
+// for this whenever it checks its time limit
+static cupdlp_bool cupdlpInterruptCheck(void* data, cupdlp_int nIter) {
+  CupdlpInterruptData& interrupt_data =
+      *static_cast<CupdlpInterruptData*>(data);
+  HighsCallback& callback = *interrupt_data.callback;
+  if (!callback.callbackActive(kCallbackIpmInterrupt)) return false;
+  callback.clearHighsCallbackDataOut();
+  callback.data_out.pdlp_iteration_count = nIter;
+  if (callback.callbackAction(kCallbackIpmInterrupt, "PDLP interrupt"))
+    interrupt_data.interrupted = true;
+  return interrupt_data.interrupted;
+}
+
+// The loops over the rows and columns of cuPDLP-C are run by the
+// HiGHS task scheduler
+static void cupdlpParallelFor(cupdlp_int n, cupdlp_int grainSize,
+                              cupdlp_loop_body body, void* data) {
+  highs::parallel::for_each(
+      0, n,
+      [&](HighsInt start, HighsInt end) {
+        body(data, cupdlp_int(start), cupdlp_int(end));
+      },
+      grainSize);
+}
+
 HighsStatus solveLpCupdlp(HighsLpSolverObject& solver_object) {
   return solveLpCupdlp(solver_object.options_, solver_object.timer_,
                        solver_object.lp_, solver_object.basis_,
@@ -136,6 +169,24 @@ HighsStatus solveLpCupdlp(const HighsOptions& options, HighsTimer& timer,
                          lower, upper, rhs);
   scaling_time = getTimeStamp() - scaling_time;
 
+  // Equations are numbered first, so sort the entries of each column
+  // by row index. Computing A^Ty column-wise then adds the products in
+  // the same order as the row-wise computation
+  std::vector<std::pair<int, double>> col_entries;
+  for (cupdlp_int iCol = 0; iCol < nCols; iCol++) {
+    const int from_el = csc_cpu->colMatBeg[iCol];
+    const int to_el = csc_cpu->colMatBeg[iCol + 1];
+    col_entries.clear();
+    for (int iEl = from_el; iEl < to_el; iEl++)
+      col_entries.emplace_back(csc_cpu->colMatIdx[iEl],
+                               csc_cpu->colMatElem[iEl]);
+    std::sort(col_entries.begin(), col_entries.end());
+    for (int iEl = from_el; iEl < to_el; iEl++) {
+      csc_cpu->colMatIdx[iEl] = col_entries[iEl - from_el].first;
+      csc_cpu->colMatElem[iEl] = col_entries[iEl - from_el].second;
+    }
+  }
+
   cupdlp_float alloc_matrix_time = 0.0;
   cupdlp_float copy_vec_time = 0.0;
 
@@ -148,6 +199,10 @@ HighsStatus solveLpCupdlp(const HighsOptions& options, HighsTimer& timer,
   PDHG_Alloc(w);
   w->timers->dScalingTime = scaling_time;
   w->timers->dPresolveTime = 0;  // presolve_time;
+  CupdlpInterruptData interrupt_data{&callback, false};
+  w->interruptCheck = cupdlpInterruptCheck;
+  w->interruptData = &interrupt_data;
+  if (highs::parallel::num_threads() > 1) w->parallelFor = cupdlpParallelFor;
   cupdlp_copy_vec(w->rowScale, scaling->rowScale, cupdlp_float, nRows);
   cupdlp_copy_vec(w->colScale, scaling->colScale, cupdlp_float, nCols);
 
@@ -192,9 +247,13 @@ HighsStatus solveLpCupdlp(const HighsOptions& options, HighsTimer& timer,
   } else if (pdlp_model_status == INFEASIBLE_OR_UNBOUNDED) {
     model_status = HighsModelStatus::kUnboundedOrInfeasible;
   } else if (pdlp_model_status == TIMELIMIT_OR_ITERLIMIT) {
-    model_status = pdlp_num_iter >= intParam[N_ITER_LIM] - 1
-                       ? HighsModelStatus::kIterationLimit
-                       : HighsModelStatus::kTimeLimit;
+    if (interrupt_data.interrupted) {
+      model_status = HighsModelStatus::kInterrupt;
+    } else {
+      model_status = pdlp_num_iter >= intParam[N_ITER_LIM] - 1
+                         ? HighsModelStatus::kIterationLimit
+                         : HighsModelStatus::kTimeLimit;
+    }
   } else if (pdlp_model_status == FEASIBLE) {
     assert(111 == 666);
     model_status = HighsModelStatus::kUnknown;
@@ -51,6 +51,8 @@ typedef struct CUPDLP_SCALING CUPDLPscaling;
 typedef struct CUPDLP_TIMERS CUPDLPtimers;
 typedef struct CUPDLP_WORK CUPDLPwork;
 typedef cupdlp_int cupdlp_retcode;
+// Body of a loop over the range [start, end)
+typedef void (*cupdlp_loop_body)(void *data, cupdlp_int start, cupdlp_int end);
 
 typedef enum {
   OPTIMAL = 0,
@@ -408,6 +410,15 @@ struct CUPDLP_WORK {
 
   cupdlp_float *rowScale;
   cupdlp_float *colScale;
+
+  // Optional check for an interrupt from the calling code, made whenever
+  // the time limit is checked
+  cupdlp_bool (*interruptCheck)(void *data, cupdlp_int nIter);
+  void *interruptData;
+  // Optional parallel loop from the calling code, running body over
+  // ranges of [0, n) with no more than grainSize entries
+  void (*parallelFor)(cupdlp_int n, cupdlp_int grainSize,
+                      cupdlp_loop_body body, void *data);
 #ifndef CUPDLP_CPU
   // CUDAmv *MV;
   cusparseHandle_t cusparsehandle;
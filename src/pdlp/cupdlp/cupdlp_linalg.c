@@ -1,6 +1,83 @@
 
 #include "cupdlp_linalg.h"
 
+/**
+ * Runs body over [0, n), in parallel if the calling code has provided a
+ * parallel loop and the nnz entries of the matrix or vector involved are
+ * enough to be worth splitting into ranges of about CUPDLP_PARALLEL_GRAIN
+ * entries.
+ */
+void cupdlp_parallelFor(CUPDLPwork *w, cupdlp_int n, cupdlp_int nnz,
+                        cupdlp_loop_body body, void *data) {
+  if (w->parallelFor && nnz >= CUPDLP_PARALLEL_MIN_ENTRIES && n > 1) {
+    cupdlp_int grainSize =
+        (cupdlp_int)(((long long)n * CUPDLP_PARALLEL_GRAIN) / nnz);
+    w->parallelFor(n, MAX(grainSize, 1), body, data);
+  } else {
+    body(data, 0, n);
+  }
+}
+
+typedef struct {
+  cupdlp_reduce_body body;
+  void *data;
+  cupdlp_int n;
+  cupdlp_int nRes;
+  cupdlp_int blockSize;
+  cupdlp_float *blockRes;
+} ReduceBlocksData;
+
+static void ReduceBlocks(void *data, cupdlp_int start, cupdlp_int end) {
+  ReduceBlocksData *reduce = (ReduceBlocksData *)data;
+  for (cupdlp_int iBlock = start; iBlock < end; ++iBlock) {
+    cupdlp_int blockStart = iBlock * reduce->blockSize;
+    cupdlp_int blockEnd = MIN(blockStart + reduce->blockSize, reduce->n);
+    reduce->body(reduce->data, blockStart, blockEnd,
+                 reduce->blockRes + iBlock * reduce->nRes);
+  }
+}
+
+/**
+ * Computes nRes sums over [0, n) by running body over a fixed partition
+ * into blocks, possibly in parallel, and adding the block results in
+ * order, so that the sums do not depend on the number of threads.
+ */
+void cupdlp_parallelReduce(CUPDLPwork *w, cupdlp_int n, cupdlp_int nRes,
+                           cupdlp_reduce_body body, void *data,
+                           cupdlp_float *res) {
+  cupdlp_float blockRes[CUPDLP_PARALLEL_REDUCE_BLOCKS *
+                        CUPDLP_PARALLEL_REDUCE_MAX_RES];
+  assert(nRes <= CUPDLP_PARALLEL_REDUCE_MAX_RES);
+
+  cupdlp_int nBlocks =
+      n < CUPDLP_PARALLEL_MIN_ENTRIES
+          ? 1
+          : MIN(n / CUPDLP_PARALLEL_GRAIN, CUPDLP_PARALLEL_REDUCE_BLOCKS);
+  for (cupdlp_int iRes = 0; iRes < nRes; ++iRes) res[iRes] = 0.0;
+  if (nBlocks <= 1) {
+    body(data, 0, n, res);
+    return;
+  }
+
+  ReduceBlocksData reduce;
+  reduce.body = body;
+  reduce.data = data;
+  reduce.n = n;
+  reduce.nRes = nRes;
+  reduce.blockSize = (n + nBlocks - 1) / nBlocks;
+  reduce.blockRes = blockRes;
+  nBlocks = (n + reduce.blockSize - 1) / reduce.blockSize;
+  for (cupdlp_int i = 0; i < nBlocks * nRes; ++i) blockRes[i] = 0.0;
+  if (w->parallelFor)
+    w->parallelFor(nBlocks, 1, ReduceBlocks, &reduce);
+  else
+    ReduceBlocks(&reduce, 0, nBlocks);
+
+  for (cupdlp_int iBlock = 0; iBlock < nBlocks; ++iBlock)
+    for (cupdlp_int iRes = 0; iRes < nRes; ++iRes)
+      res[iRes] += blockRes[iBlock * nRes + iRes];
+}
+
 /**
  * The function `ScatterCol` performs a scatter operation on a specific
  * column of a matrix.
@@ -32,6 +109,46 @@ void ScatterRow(CUPDLPwork *w, cupdlp_int iRow, cupdlp_float multiplier,
     target[matrix->rowMatIdx[p]] += matrix->rowMatElem[p] * multiplier;
 }
 
+typedef struct {
+  const CUPDLPcsr *matrix;
+  const cupdlp_float *x;
+  cupdlp_float *ax;
+} AxData;
+
+static void AxRows(void *data, cupdlp_int start, cupdlp_int end) {
+  const AxData *ax_data = (const AxData *)data;
+  const cupdlp_int *rowMatBeg = ax_data->matrix->rowMatBeg;
+  const cupdlp_int *rowMatIdx = ax_data->matrix->rowMatIdx;
+  const cupdlp_float *rowMatElem = ax_data->matrix->rowMatElem;
+  const cupdlp_float *x = ax_data->x;
+  for (cupdlp_int iRow = start; iRow < end; ++iRow) {
+    cupdlp_float sum = 0.0;
+    for (cupdlp_int p = rowMatBeg[iRow]; p < rowMatBeg[iRow + 1]; ++p)
+      sum += rowMatElem[p] * x[rowMatIdx[p]];
+    ax_data->ax[iRow] = sum;
+  }
+}
+
+typedef struct {
+  const CUPDLPcsc *matrix;
+  const cupdlp_float *y;
+  cupdlp_float *aty;
+} ATyData;
+
+static void ATyCols(void *data, cupdlp_int start, cupdlp_int end) {
+  const ATyData *aty_data = (const ATyData *)data;
+  const cupdlp_int *colMatBeg = aty_data->matrix->colMatBeg;
+  const cupdlp_int *colMatIdx = aty_data->matrix->colMatIdx;
+  const cupdlp_float *colMatElem = aty_data->matrix->colMatElem;
+  const cupdlp_float *y = aty_data->y;
+  for (cupdlp_int iCol = start; iCol < end; ++iCol) {
+    cupdlp_float sum = 0.0;
+    for (cupdlp_int p = colMatBeg[iCol]; p < colMatBeg[iCol + 1]; ++p)
+      sum += colMatElem[p] * y[colMatIdx[p]];
+    aty_data->aty[iCol] = sum;
+  }
+}
+
 void AxCPU(CUPDLPwork *w, cupdlp_float *ax, const cupdlp_float *x) {
   // #if PDHG_USE_TIMERS
   //     ++w->timers->nAxCalls;
@@ -59,11 +176,13 @@ void AxCPU(CUPDLPwork *w, cupdlp_float *ax, const cupdlp_float *x) {
   }
   */
 
-  memset(ax, 0, sizeof(cupdlp_float) * lp->data->nRows);
-
-  for (cupdlp_int iCol = 0; iCol < lp->data->nCols; ++iCol) {
-    ScatterCol(w, iCol, x[iCol], ax);
-  }
+  // Each entry of Ax is computed as the product of a row of A with x,
+  // so rows can be handled in parallel without any write conflicts
+  AxData data;
+  data.matrix = lp->data->csr_matrix;
+  data.x = x;
+  data.ax = ax;
+  cupdlp_parallelFor(w, lp->data->nRows, data.matrix->nMatElem, AxRows, &data);
 
   // #if PDHG_USE_TIMERS
   //     w->timers->dAxTime += getTimeStamp() - dStartTime;
@@ -98,10 +217,14 @@ void ATyCPU(CUPDLPwork *w, cupdlp_float *aty, const cupdlp_float *y) {
   }
   */
 
-  memset(aty, 0, sizeof(cupdlp_float) * lp->data->nCols);
-  for (cupdlp_int iRow = 0; iRow < lp->data->nRows; ++iRow) {
-    ScatterRow(w, iRow, y[iRow], aty);
-  }
+  // Each entry of A'y is computed as the product of a column of A with
+  // y, so columns can be handled in parallel without any write conflicts
+  ATyData data;
+  data.matrix = lp->data->csc_matrix;
+  data.y = y;
+  data.aty = aty;
+  cupdlp_parallelFor(w, lp->data->nCols, data.matrix->nMatElem, ATyCols,
+                     &data);
 
   // #if PDHG_USE_TIMERS
   //     w->timers->dAtyTime += getTimeStamp() - dStartTime;
@@ -7,6 +7,31 @@
 #include "cuda/cupdlp_cudalinalg.cuh"
 #endif
 
+// Loops are only run in parallel when they involve at least this
+// many matrix or vector entries, and then in ranges of about
+// CUPDLP_PARALLEL_GRAIN entries, so that the scheduling overhead is
+// negligible
+#define CUPDLP_PARALLEL_MIN_ENTRIES 65536
+#define CUPDLP_PARALLEL_GRAIN 16384
+// Maximum number of blocks into which a reduction is split. The
+// partition depends only on the length of the vectors, so the result
+// is independent of the number of threads
+#define CUPDLP_PARALLEL_REDUCE_BLOCKS 64
+// Maximum number of values computed in one reduction
+#define CUPDLP_PARALLEL_REDUCE_MAX_RES 2
+
+// Body of a reduction over the range [start, end), adding its results
+// to res
+typedef void (*cupdlp_reduce_body)(void *data, cupdlp_int start,
+                                   cupdlp_int end, cupdlp_float *res);
+
+void cupdlp_parallelFor(CUPDLPwork *w, cupdlp_int n, cupdlp_int nnz,
+                        cupdlp_loop_body body, void *data);
+
+void cupdlp_parallelReduce(CUPDLPwork *w, cupdlp_int n, cupdlp_int nRes,
+                           cupdlp_reduce_body body, void *data,
+                           cupdlp_float *res);
+
 void ScatterCol(CUPDLPwork *w, cupdlp_int iCol, cupdlp_float multiplier,
                 cupdlp_float *target);
 
@@ -879,6 +879,13 @@ cupdlp_retcode PDHG_Solve(CUPDLPwork *pdhg) {
         break;
       }
 
+      if (pdhg->interruptCheck &&
+          pdhg->interruptCheck(pdhg->interruptData, timers->nIter)) {
+        // cupdlp_printf("Interrupted.\n");
+        resobj->termCode = TIMELIMIT_OR_ITERLIMIT;
+        break;
+      }
+
       if (timers->nIter >= (settings->nIterLim - 1)) {
         // cupdlp_printf("Iteration limit reached.\n");
         resobj->termCode = TIMELIMIT_OR_ITERLIMIT;
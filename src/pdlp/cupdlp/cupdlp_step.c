@@ -71,6 +71,103 @@ void PDHG_dualGradientStep(CUPDLPwork *work, cupdlp_float dDualStepSize) {
 #endif
 }
 
+#if defined(CUPDLP_CPU) || !USE_KERNELS
+typedef struct {
+  const cupdlp_float *x;
+  const cupdlp_float *cost;
+  const cupdlp_float *aty;
+  const cupdlp_float *lower;
+  const cupdlp_float *upper;
+  cupdlp_float *xUpdate;
+  cupdlp_float dPrimalStepSize;
+} PrimalStepData;
+
+static void PDHG_primalStepCols(void *data, cupdlp_int start,
+                                cupdlp_int end) {
+  const PrimalStepData *step = (const PrimalStepData *)data;
+  // Same order of operations as the separate vector operations
+  const cupdlp_float alpha = -step->dPrimalStepSize;
+  for (cupdlp_int iCol = start; iCol < end; ++iCol) {
+    cupdlp_float xUpdate = step->x[iCol];
+    xUpdate += alpha * step->cost[iCol];
+    xUpdate += step->dPrimalStepSize * step->aty[iCol];
+    xUpdate = MIN(xUpdate, step->upper[iCol]);
+    step->xUpdate[iCol] = MAX(xUpdate, step->lower[iCol]);
+  }
+}
+
+typedef struct {
+  const cupdlp_float *y;
+  const cupdlp_float *rhs;
+  const cupdlp_float *ax;
+  const cupdlp_float *axUpdate;
+  cupdlp_float *yUpdate;
+  cupdlp_float dDualStepSize;
+  cupdlp_int nEqs;
+} DualStepData;
+
+static void PDHG_dualStepRows(void *data, cupdlp_int start, cupdlp_int end) {
+  const DualStepData *step = (const DualStepData *)data;
+  // Same order of operations as the separate vector operations
+  const cupdlp_float alpha = -2.0 * step->dDualStepSize;
+  for (cupdlp_int iRow = start; iRow < end; ++iRow) {
+    cupdlp_float yUpdate = step->y[iRow];
+    yUpdate += step->dDualStepSize * step->rhs[iRow];
+    yUpdate += alpha * step->axUpdate[iRow];
+    yUpdate += step->dDualStepSize * step->ax[iRow];
+    step->yUpdate[iRow] = iRow < step->nEqs ? yUpdate : MAX(yUpdate, 0.0);
+  }
+}
+#endif
+
+// xUpdate = proj_{X}(x^k - dPrimalStep * (c - A'y^k)), which is a
+// single sweep over the columns on CPU
+void PDHG_projectedPrimalGradientStep(CUPDLPwork *work,
+                                      cupdlp_float dPrimalStepSize) {
+#if !defined(CUPDLP_CPU) & USE_KERNELS
+  PDHG_primalGradientStep(work, dPrimalStepSize);
+  PDHG_Project_Bounds(work, work->iterates->xUpdate->data);
+#else
+  CUPDLPiterates *iterates = work->iterates;
+  CUPDLPproblem *problem = work->problem;
+
+  PrimalStepData data;
+  data.x = iterates->x->data;
+  data.cost = problem->cost;
+  data.aty = iterates->aty->data;
+  data.lower = problem->lower;
+  data.upper = problem->upper;
+  data.xUpdate = iterates->xUpdate->data;
+  data.dPrimalStepSize = dPrimalStepSize;
+  cupdlp_parallelFor(work, problem->nCols, problem->nCols,
+                     PDHG_primalStepCols, &data);
+#endif
+}
+
+// yUpdate = proj_{Y}(y^k + dDualStep * (b - A * (2x^{k+1} - x^{k}))),
+// which is a single sweep over the rows on CPU
+void PDHG_projectedDualGradientStep(CUPDLPwork *work,
+                                    cupdlp_float dDualStepSize) {
+#if !defined(CUPDLP_CPU) & USE_KERNELS
+  PDHG_dualGradientStep(work, dDualStepSize);
+  PDHG_Project_Row_Duals(work, work->iterates->yUpdate->data);
+#else
+  CUPDLPiterates *iterates = work->iterates;
+  CUPDLPproblem *problem = work->problem;
+
+  DualStepData data;
+  data.y = iterates->y->data;
+  data.rhs = problem->rhs;
+  data.ax = iterates->ax->data;
+  data.axUpdate = iterates->axUpdate->data;
+  data.yUpdate = iterates->yUpdate->data;
+  data.dDualStepSize = dDualStepSize;
+  data.nEqs = problem->nEqs;
+  cupdlp_parallelFor(work, problem->nRows, problem->nRows, PDHG_dualStepRows,
+                     &data);
+#endif
+}
+
 cupdlp_retcode PDHG_Power_Method(CUPDLPwork *work, cupdlp_float *lambda) {
   cupdlp_retcode retcode = RETCODE_OK;
   CUPDLPproblem *problem = work->problem;
@@ -155,16 +252,14 @@ void PDHG_Update_Iterate_Constant_Step_Size(CUPDLPwork *pdhg) {
   ATy(pdhg, iterates->aty, iterates->y);
 
   // x^{k+1} = proj_{X}(x^k - dPrimalStep * (c - A'y^k))
-  PDHG_primalGradientStep(pdhg, stepsize->dPrimalStep);
+  PDHG_projectedPrimalGradientStep(pdhg, stepsize->dPrimalStep);
 
-  PDHG_Project_Bounds(pdhg, iterates->xUpdate->data);
   // Ax(pdhg, iterates->axUpdate, iterates->xUpdate);
   Ax(pdhg, iterates->axUpdate, iterates->xUpdate);
 
   // y^{k+1} = y^k + dDualStep * (b - A * (2x^{k+1} - x^{k})
-  PDHG_dualGradientStep(pdhg, stepsize->dDualStep);
+  PDHG_projectedDualGradientStep(pdhg, stepsize->dDualStep);
 
-  PDHG_Project_Row_Duals(pdhg, iterates->yUpdate->data);
   // ATyCPU(pdhg, iterates->atyUpdate, iterates->yUpdate);
   ATy(pdhg, iterates->atyUpdate, iterates->yUpdate);
 }
@@ -176,6 +271,34 @@ void PDHG_Update_Iterate_Malitsky_Pock(CUPDLPwork *pdhg) {
   exit(-1);
 }
 
+#if defined(CUPDLP_CPU) || !USE_KERNELS
+typedef struct {
+  const cupdlp_float *x;
+  const cupdlp_float *xUpdate;
+  const cupdlp_float *aty;
+  const cupdlp_float *atyUpdate;
+} MovementInteractionData;
+
+static void PDHG_movementInteractionCols(void *data, cupdlp_int start,
+                                         cupdlp_int end, cupdlp_float *res) {
+  const MovementInteractionData *d = (const MovementInteractionData *)data;
+  for (cupdlp_int iCol = start; iCol < end; ++iCol) {
+    cupdlp_float dx = d->x[iCol] - d->xUpdate[iCol];
+    res[0] += dx * dx;
+    res[1] += dx * (d->aty[iCol] - d->atyUpdate[iCol]);
+  }
+}
+
+static void PDHG_movementRows(void *data, cupdlp_int start, cupdlp_int end,
+                              cupdlp_float *res) {
+  const MovementInteractionData *d = (const MovementInteractionData *)data;
+  for (cupdlp_int iRow = start; iRow < end; ++iRow) {
+    cupdlp_float dy = d->x[iRow] - d->xUpdate[iRow];
+    res[0] += dy * dy;
+  }
+}
+#endif
+
 cupdlp_retcode PDHG_Update_Iterate_Adaptive_Step_Size(CUPDLPwork *pdhg) {
   cupdlp_retcode retcode = RETCODE_OK;
   CUPDLPproblem *problem = pdhg->problem;
@@ -196,15 +319,13 @@ cupdlp_retcode PDHG_Update_Iterate_Adaptive_Step_Size(CUPDLPwork *pdhg) {
     cupdlp_float dDualStepUpdate = dStepSizeUpdate * sqrt(stepsize->dBeta);
 
     // x^{k+1} = proj_{X}(x^k - dPrimalStep * (cupdlp - A'y^k))
-    PDHG_primalGradientStep(pdhg, dPrimalStepUpdate);
+    PDHG_projectedPrimalGradientStep(pdhg, dPrimalStepUpdate);
 
-    PDHG_Project_Bounds(pdhg, iterates->xUpdate->data);
     Ax(pdhg, iterates->axUpdate, iterates->xUpdate);
 
     // y^{k+1} = proj_{Y}(y^k + dDualStep * (b - A * (2 * x^{k+1} - x^{k})))
-    PDHG_dualGradientStep(pdhg, dDualStepUpdate);
+    PDHG_projectedDualGradientStep(pdhg, dDualStepUpdate);
 
-    PDHG_Project_Row_Duals(pdhg, iterates->yUpdate->data);
     ATy(pdhg, iterates->atyUpdate, iterates->yUpdate);
 
     cupdlp_float dMovement = 0.0;
@@ -213,21 +334,26 @@ cupdlp_retcode PDHG_Update_Iterate_Adaptive_Step_Size(CUPDLPwork *pdhg) {
 #if !defined(CUPDLP_CPU) & USE_KERNELS
     cupdlp_compute_interaction_and_movement(pdhg, &dMovement, &dInteraction);
 #else
-    cupdlp_float dX = 0.0;
-    cupdlp_diffTwoNormSquared(pdhg, iterates->x->data, iterates->xUpdate->data,
-                              problem->nCols, &dX);
+    // ||\Deltax||^2 and \Deltax' (A\Deltay) in a single sweep
+    cupdlp_float dXInteraction[2];
+    MovementInteractionData data;
+    data.x = iterates->x->data;
+    data.xUpdate = iterates->xUpdate->data;
+    data.aty = iterates->aty->data;
+    data.atyUpdate = iterates->atyUpdate->data;
+    cupdlp_parallelReduce(pdhg, problem->nCols, 2, PDHG_movementInteractionCols,
+                          &data, dXInteraction);
+    cupdlp_float dX = dXInteraction[0];
     dX *= 0.5 * sqrt(stepsize->dBeta);
+    dInteraction = dXInteraction[1];
 
     cupdlp_float dY = 0.0;
-    cupdlp_diffTwoNormSquared(pdhg, iterates->y->data, iterates->yUpdate->data,
-                              problem->nRows, &dY);
+    data.x = iterates->y->data;
+    data.xUpdate = iterates->yUpdate->data;
+    cupdlp_parallelReduce(pdhg, problem->nRows, 1, PDHG_movementRows, &data,
+                          &dY);
     dY /= 2.0 * sqrt(stepsize->dBeta);
     dMovement = dX + dY;
-
-    //      \Deltax' (A\Deltay)
-    cupdlp_diffDotDiff(pdhg, iterates->x->data, iterates->xUpdate->data,
-                       iterates->aty->data, iterates->atyUpdate->data,
-                       problem->nCols, &dInteraction);
 #endif
 
 #if CUPDLP_DUMP_LINESEARCH_STATS & CUPDLP_DEBUG
@@ -29,5 +29,9 @@ cupdlp_retcode PDHG_Update_Iterate(CUPDLPwork *pdhg);
 
 void PDHG_primalGradientStep(CUPDLPwork *work, cupdlp_float dPrimalStepSize);
 void PDHG_dualGradientStep(CUPDLPwork *work, cupdlp_float dDualStepSize);
+void PDHG_projectedPrimalGradientStep(CUPDLPwork *work,
+                                      cupdlp_float dPrimalStepSize);
+void PDHG_projectedDualGradientStep(CUPDLPwork *work,
+                                    cupdlp_float dDualStepSize);
 
 #endif  // CUPDLP_CUPDLP_STEP_H
@@ -1035,6 +1035,12 @@ cupdlp_retcode PDHG_Alloc(CUPDLPwork *w) {
   CUPDLP_INIT_TIMERS(w->timers, 1);
   CUPDLP_CALL(timers_Alloc(w->timers));
 
+  // no interrupt check unless set by the calling code
+  w->interruptCheck = cupdlp_NULL;
+  w->interruptData = cupdlp_NULL;
+  // loops are serial unless a parallel loop is set by the calling code
+  w->parallelFor = cupdlp_NULL;
+
   cupdlp_float begin = getTimeStamp();
   // buffer
   CUPDLP_INIT_CUPDLP_VEC(w->buffer, 1);
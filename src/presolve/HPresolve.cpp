@@ -24,6 +24,7 @@
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsObjectiveFunction.h"
 #include "mip/MipTimer.h"
+#include "parallel/HighsParallel.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "test/DevKkt.h"
 #include "util/HFactor.h"
@@ -44,6 +45,10 @@
 
 namespace presolve {
 
+// number of rows or columns processed by a single task in the detection loops
+// that run in parallel, smaller problems are handled by the calling thread
+static constexpr HighsInt kDetectionGrainSize = 1024;
+
 #ifndef NDEBUG
 void HPresolve::debugPrintRow(HighsPostsolveStack& postsolve_stack,
                               HighsInt row) {
@@ -100,6 +105,11 @@ bool HPresolve::okSetInput(HighsLp& model_, const HighsOptions& options_,
   } else
     primal_feastol = options->mip_feasibility_tolerance;
 
+  // when LP presolve reductions are to be reused for different costs, the
+  // implied bounds on the row duals are not computed, and columns are not
+  // fixed or merged based on their costs
+  dualReductionsEnabled = mipsolver != nullptr || !options->presolve_reuse;
+
   if (model_.a_matrix_.isRowwise()) {
     // Does this even happen?
     assert(model_.a_matrix_.isColwise());
@@ -529,6 +539,8 @@ double HPresolve::getMaxAbsRowVal(HighsInt row) const {
 
 void HPresolve::updateRowDualImpliedBounds(HighsInt row, HighsInt col,
                                            double val) {
+  if (!dualReductionsEnabled) return;
+
   // propagate implied row dual bound
   // if the column has an infinite lower bound the reduced cost cannot be
   // positive, i.e. the column corresponds to a <= constraint in the dual with
@@ -1046,20 +1058,26 @@ HPresolve::Result HPresolve::dominatedColumns(
     return true;
   };
 
-  HighsInt numNz = Avalue.size();
-  for (HighsInt i = 0; i < numNz; ++i) {
-    if (Avalue[i] == 0) continue;
-
-    HighsInt row = Arow[i];
-    HighsInt col = Acol[i];
-    bool rowLowerFinite = model->row_lower_[row] != -kHighsInf;
-    bool rowUpperFinite = model->row_upper_[row] != kHighsInf;
-
-    if (Avalue[i] > 0)
-      addSignature(row, col, rowLowerFinite, rowUpperFinite);
-    else
-      addSignature(row, col, rowUpperFinite, rowLowerFinite);
-  }
+  // the signature of a column only depends on its own column vector, hence
+  // the signatures are computed for blocks of columns in parallel
+  highs::parallel::for_each(
+      0, model->num_col_,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt col = start; col < end; ++col) {
+          if (colDeleted[col]) continue;
+          for (const HighsSliceNonzero& nonz : getColumnVector(col)) {
+            HighsInt row = nonz.index();
+            bool rowLowerFinite = model->row_lower_[row] != -kHighsInf;
+            bool rowUpperFinite = model->row_upper_[row] != kHighsInf;
+
+            if (nonz.value() > 0)
+              addSignature(row, col, rowLowerFinite, rowUpperFinite);
+            else
+              addSignature(row, col, rowUpperFinite, rowLowerFinite);
+          }
+        }
+      },
+      kDetectionGrainSize);
 
   HighsInt numFixedCols = 0;
   for (HighsInt j = 0; j < model->num_col_; ++j) {
@@ -1449,12 +1467,26 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
   std::vector<std::tuple<int64_t, HighsInt, HighsInt, HighsInt>> binaries;
 
   if (!mipsolver->mipdata_->cliquetable.isFull()) {
+    // count the implications of all binaries in parallel, the clique table is
+    // only read here
+    std::vector<std::pair<HighsInt, HighsInt>> numImplics(model->num_col_);
+    highs::parallel::for_each(
+        0, model->num_col_,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i < end; ++i) {
+            if (!domain.isBinary(i)) continue;
+            numImplics[i].first = cliquetable.getNumImplications(i, 1);
+            numImplics[i].second = cliquetable.getNumImplications(i, 0);
+          }
+        },
+        kDetectionGrainSize);
+
     binaries.reserve(model->num_col_);
     HighsRandom random(options->random_seed);
     for (HighsInt i = 0; i != model->num_col_; ++i) {
       if (domain.isBinary(i)) {
-        HighsInt implicsUp = cliquetable.getNumImplications(i, 1);
-        HighsInt implicsDown = cliquetable.getNumImplications(i, 0);
+        HighsInt implicsUp = numImplics[i].first;
+        HighsInt implicsDown = numImplics[i].second;
         binaries.emplace_back(
             -std::min(int64_t{5000}, int64_t(implicsUp) * implicsDown) /
                 (1.0 + numProbes[i]),
@@ -3705,6 +3737,9 @@ HPresolve::Result HPresolve::rowPresolve(HighsPostsolveStack& postsolve_stack,
 
 HPresolve::Result HPresolve::emptyCol(HighsPostsolveStack& postsolve_stack,
                                       HighsInt col) {
+  // the value of an empty column is determined by its cost alone
+  if (!dualReductionsEnabled) return Result::kOk;
+
   const bool logging_on = analysis_.logging_on_;
   if (logging_on) analysis_.startPresolveRuleLog(kPresolveRuleEmptyCol);
   if ((model->col_cost_[col] > 0 && model->col_lower_[col] == -kHighsInf) ||
@@ -3860,6 +3895,7 @@ HPresolve::Result HPresolve::detectDominatedCol(
     HighsPostsolveStack& postsolve_stack, HighsInt col,
     bool handleSingletonRows) {
   assert(!colDeleted[col]);
+  if (!dualReductionsEnabled) return Result::kOk;
 
   // get bounds on column dual
   double colDualUpper =
@@ -5418,21 +5454,43 @@ HPresolve::Result HPresolve::detectParallelRowsAndCols(
   }
 
   // Step 2: Compute hash values for rows and columns excluding singleton
-  // columns
-  for (HighsInt i = 0; i != nnz; ++i) {
-    if (Avalue[i] == 0.0) continue;
-    assert(!rowDeleted[Arow[i]] && !colDeleted[Acol[i]]);
-    if (colsize[Acol[i]] == 1) {
-      colHashes[Acol[i]] = Arow[i];
-    } else {
-      HighsHashHelpers::sparse_combine(rowHashes[Arow[i]], Acol[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / rowMax[Arow[i]].first));
-      HighsHashHelpers::sparse_combine(colHashes[Acol[i]], Arow[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / colMax[Acol[i]].first));
-    }
-  }
+  // columns. The sparse hash does not depend on the order in which the
+  // nonzeros are combined, so the rows and the columns are hashed
+  // independently of each other in parallel
+  highs::parallel::for_each(
+      0, model->num_row_,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt row = start; row < end; ++row) {
+          if (rowDeleted[row]) continue;
+          for (const HighsSliceNonzero& nonz : getRowVector(row)) {
+            if (colsize[nonz.index()] == 1) continue;
+            HighsHashHelpers::sparse_combine(
+                rowHashes[row], nonz.index(),
+                HighsHashHelpers::double_hash_code(nonz.value() /
+                                                   rowMax[row].first));
+          }
+        }
+      },
+      kDetectionGrainSize);
+
+  highs::parallel::for_each(
+      0, model->num_col_,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt col = start; col < end; ++col) {
+          if (colDeleted[col]) continue;
+          if (colsize[col] == 1) {
+            for (const HighsSliceNonzero& nonz : getColumnVector(col))
+              colHashes[col] = nonz.index();
+            continue;
+          }
+          for (const HighsSliceNonzero& nonz : getColumnVector(col))
+            HighsHashHelpers::sparse_combine(
+                colHashes[col], nonz.index(),
+                HighsHashHelpers::double_hash_code(nonz.value() /
+                                                   colMax[col].first));
+        }
+      },
+      kDetectionGrainSize);
 
   // Step 3: Loop over the rows and columns and put them into buckets using the
   // computed hash values. Whenever a bucket already contains a row/column,
@@ -5447,6 +5505,8 @@ HPresolve::Result HPresolve::detectParallelRowsAndCols(
       HPRESOLVE_CHECKED_CALL(colPresolve(postsolve_stack, i));
       continue;
     }
+    // parallel columns can only be merged if their costs are parallel
+    if (!dualReductionsEnabled) continue;
     auto it = buckets.find(colHashes[i]);
     decltype(it) last = it;
 
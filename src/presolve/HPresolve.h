@@ -102,6 +102,8 @@ class HPresolve {
   std::vector<std::set<std::pair<HighsInt, HighsInt>>::iterator> eqiters;
 
   bool shrinkProblemEnabled;
+  // whether reductions that depend on the costs may be applied
+  bool dualReductionsEnabled;
   size_t reductionLimit;
 
   // vectors storing singleton rows and columns
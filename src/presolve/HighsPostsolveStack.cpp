@@ -57,6 +57,94 @@ void HighsPostsolveStack::compressIndexMaps(
   origColIndex.resize(numCol);
 }
 
+bool HighsPostsolveStack::transformCosts(std::vector<double>& colCost,
+                                         double& offset) {
+  assert(static_cast<HighsInt>(colCost.size()) == origNumCol);
+  HighsCDouble objOffset = offset;
+
+  // substitute x[col] = (rhs - sum_j a_j x_j) / a_col in the objective
+  auto substituteCol = [&](HighsInt col, double rhs,
+                           const std::vector<Nonzero>& rowVec) {
+    if (colCost[col] == 0.0) return;
+    double colCoef = 0;
+    for (const Nonzero& rowVal : rowVec)
+      if (rowVal.index == col) colCoef = rowVal.value;
+    assert(colCoef != 0);
+    HighsCDouble objScale = colCost[col] / HighsCDouble(colCoef);
+    objOffset += objScale * rhs;
+    for (const Nonzero& rowVal : rowVec)
+      colCost[rowVal.index] =
+          double(colCost[rowVal.index] - objScale * rowVal.value);
+    colCost[col] = 0.0;
+  };
+
+  for (const std::pair<ReductionType, size_t>& reduction : reductions) {
+    reductionValues.setPosition(reduction.second);
+    switch (reduction.first) {
+      case ReductionType::kLinearTransform: {
+        LinearTransform transform;
+        reductionValues.pop(transform);
+        objOffset += colCost[transform.col] * transform.constant;
+        colCost[transform.col] *= transform.scale;
+        break;
+      }
+      case ReductionType::kFreeColSubstitution: {
+        FreeColSubstitution substitution;
+        reductionValues.pop(colValues);
+        reductionValues.pop(rowValues);
+        reductionValues.pop(substitution);
+        substitution.colCost = colCost[substitution.col];
+        reductionValues.overwrite(substitution);
+        substituteCol(substitution.col, substitution.rhs, rowValues);
+        break;
+      }
+      case ReductionType::kDoubletonEquation: {
+        // x[colSubst] = (rhs - coef * x[col]) / coefSubst
+        DoubletonEquation doubleton;
+        reductionValues.pop(colValues);
+        reductionValues.pop(doubleton);
+        double substCost = colCost[doubleton.colSubst];
+        doubleton.substCost = substCost;
+        reductionValues.overwrite(doubleton);
+        if (substCost != 0.0) {
+          objOffset += substCost * (doubleton.rhs / doubleton.coefSubst);
+          colCost[doubleton.col] +=
+              substCost * (-doubleton.coef / doubleton.coefSubst);
+          colCost[doubleton.colSubst] = 0.0;
+        }
+        break;
+      }
+      case ReductionType::kFixedCol: {
+        FixedCol fixedCol;
+        reductionValues.pop(colValues);
+        reductionValues.pop(fixedCol);
+        fixedCol.colCost = colCost[fixedCol.col];
+        reductionValues.overwrite(fixedCol);
+        objOffset += fixedCol.colCost * fixedCol.fixValue;
+        colCost[fixedCol.col] = 0.0;
+        break;
+      }
+      case ReductionType::kSlackColSubstitution: {
+        SlackColSubstitution substitution;
+        reductionValues.pop(rowValues);
+        reductionValues.pop(substitution);
+        substituteCol(substitution.col, substitution.rhs, rowValues);
+        break;
+      }
+      case ReductionType::kForcingColumn:
+      case ReductionType::kDuplicateColumn:
+        // these reductions require conditions on the costs
+        return false;
+      default:
+        // reductions of rows leave the objective unchanged
+        break;
+    }
+  }
+
+  offset = double(objOffset);
+  return true;
+}
+
 void HighsPostsolveStack::LinearTransform::undo(const HighsOptions& options,
                                                 HighsSolution& solution) const {
   solution.col_value[col] *= scale;
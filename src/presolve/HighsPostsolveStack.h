@@ -935,6 +935,12 @@ class HighsPostsolveStack {
   }
 
   size_t numReductions() const { return reductions.size(); }
+
+  /// transform the costs and objective offset of the original problem, given
+  /// in the original index space, to those of the reduced problem and record
+  /// the transformed costs with the reductions. Returns false if a reduction
+  /// is only valid for the costs with which it was applied
+  bool transformCosts(std::vector<double>& colCost, double& offset);
 };
 
 }  // namespace presolve
@@ -29,6 +29,15 @@ void PresolveComponent::negateReducedLpColDuals() {
 }
 
 HighsPresolveStatus PresolveComponent::run() {
+  if (!options_->presolve_reuse) {
+    cache_.clear();
+  } else if (reuseCache()) {
+    return presolve_status_;
+  } else {
+    cache_.clear();
+    cache_.lp_ = data_.reduced_lp_;
+  }
+
   presolve::HPresolve presolve;
   if (!presolve.okSetInput(data_.reduced_lp_, *options_,
                            options_->presolve_reduction_limit, timer)) {
@@ -39,7 +48,67 @@ HighsPresolveStatus PresolveComponent::run() {
   presolve.run(data_.postSolveStack);
   data_.presolve_log_ = presolve.getPresolveLog();
   presolve_status_ = presolve.getPresolveStatus();
+
+  if (options_->presolve_reuse &&
+      (presolve_status_ == HighsPresolveStatus::kNotReduced ||
+       presolve_status_ == HighsPresolveStatus::kReduced ||
+       presolve_status_ == HighsPresolveStatus::kReducedToEmpty)) {
+    cache_.reduced_lp_ = data_.reduced_lp_;
+    cache_.postSolveStack = data_.postSolveStack;
+    cache_.presolve_log_ = data_.presolve_log_;
+    cache_.presolve_status_ = presolve_status_;
+    cache_.is_valid = true;
+  }
   return presolve_status_;
 }
 
+bool PresolveComponent::reuseCache() {
+  // On entry, the reduced LP is a copy of the LP to be presolved
+  const HighsLp& lp = data_.reduced_lp_;
+  if (!cache_.okReuse(lp)) return false;
+
+  // Presolve minimizes, so transform the costs of a maximization LP
+  // accordingly before applying the cached reductions to them
+  std::vector<double> col_cost = lp.col_cost_;
+  double offset = lp.offset_;
+  if (lp.sense_ == ObjSense::kMaximize) {
+    for (double& cost : col_cost) cost = -cost;
+    offset = -offset;
+  }
+  presolve::HighsPostsolveStack postsolve_stack = cache_.postSolveStack;
+  if (!postsolve_stack.transformCosts(col_cost, offset)) return false;
+
+  HighsLp reduced_lp = cache_.reduced_lp_;
+  for (HighsInt iCol = 0; iCol < reduced_lp.num_col_; iCol++)
+    reduced_lp.col_cost_[iCol] =
+        col_cost[postsolve_stack.getOrigColIndex(iCol)];
+  reduced_lp.offset_ = offset;
+
+  data_.reduced_lp_ = std::move(reduced_lp);
+  data_.postSolveStack = std::move(postsolve_stack);
+  data_.presolve_log_ = cache_.presolve_log_;
+  presolve_status_ = cache_.presolve_status_;
+  highsLogUser(options_->log_options, HighsLogType::kInfo,
+               "Reusing presolve reductions since only the costs have "
+               "changed\n");
+  return true;
+}
+
 void PresolveComponent::clear() { data_.clear(); }
+
+void PresolveComponentCache::clear() {
+  is_valid = false;
+  lp_.clear();
+  reduced_lp_.clear();
+  postSolveStack = presolve::HighsPostsolveStack();
+  presolve_log_.rule.clear();
+  presolve_status_ = HighsPresolveStatus::kNotPresolved;
+}
+
+bool PresolveComponentCache::okReuse(const HighsLp& lp) const {
+  if (!is_valid) return false;
+  return lp.num_col_ == lp_.num_col_ && lp.num_row_ == lp_.num_row_ &&
+         lp.col_lower_ == lp_.col_lower_ && lp.col_upper_ == lp_.col_upper_ &&
+         lp.row_lower_ == lp_.row_lower_ && lp.row_upper_ == lp_.row_upper_ &&
+         lp.a_matrix_ == lp_.a_matrix_ && lp.integrality_ == lp_.integrality_;
+}
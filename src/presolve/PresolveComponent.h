@@ -50,6 +50,21 @@ struct PresolveComponentData : public HighsComponentData {
   virtual ~PresolveComponentData() = default;
 };
 
+// Data from presolving an LP using only reductions that are independent of
+// the costs, retained so that the reductions can be reused when only the costs
+// of the LP change
+struct PresolveComponentCache {
+  bool is_valid = false;
+  HighsLp lp_;
+  HighsLp reduced_lp_;
+  presolve::HighsPostsolveStack postSolveStack;
+  HighsPresolveLog presolve_log_;
+  HighsPresolveStatus presolve_status_ = HighsPresolveStatus::kNotPresolved;
+
+  void clear();
+  bool okReuse(const HighsLp& lp) const;
+};
+
 // HighsComponentInfo is a placeholder for details we want to query from outside
 // of HiGHS like execution information. Times are recorded at the end of
 // Highs::run()
@@ -86,5 +101,12 @@ class PresolveComponent : public HighsComponent {
   HighsPostsolveStatus postsolve_status_ = HighsPostsolveStatus::kNotPresolved;
 
   virtual ~PresolveComponent() = default;
+
+ private:
+  // Not cleared with the presolve data, since it is valid for any LP
+  // with the same constraints and bounds
+  PresolveComponentCache cache_;
+
+  bool reuseCache();
 };
 #endif
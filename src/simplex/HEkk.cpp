@@ -1090,8 +1090,15 @@ HighsStatus HEkk::solve(const bool force_phase2) {
     algorithm_name = "primal";
     reportSimplexPhaseIterations(options_->log_options, iteration_count_, info_,
                                  true);
-    highsLogUser(options_->log_options, HighsLogType::kInfo,
-                 "Using EKK primal simplex solver\n");
+    if (info_.num_concurrency > 1) {
+      highsLogUser(options_->log_options, HighsLogType::kInfo,
+                   "Using EKK parallel primal simplex solver with "
+                   "concurrency of %" HIGHSINT_FORMAT "\n",
+                   info_.num_concurrency);
+    } else {
+      highsLogUser(options_->log_options, HighsLogType::kInfo,
+                   "Using EKK primal simplex solver\n");
+    }
     HEkkPrimal primal_solver(*this);
     call_status = primal_solver.solve(force_phase2);
     assert(called_return_from_solve_);
@@ -1780,6 +1787,13 @@ void HEkk::chooseSimplexStrategyThreads(const HighsOptions& options,
     info.min_concurrency =
         max(kDualMultiMinConcurrency, simplex_min_concurrency);
     info.max_concurrency = max(info.min_concurrency, simplex_max_concurrency);
+  } else if (options.parallel == kHighsOnString &&
+             simplex_strategy == kSimplexStrategyPrimal) {
+    // The parallel strategy is on and the simplex strategy is primal,
+    // so slice PRICE and CHUZC
+    info.min_concurrency =
+        max(kPrimalTasksMinConcurrency, simplex_min_concurrency);
+    info.max_concurrency = max(info.min_concurrency, simplex_max_concurrency);
   }
 
   // Set the concurrency to be used to be the maximum number
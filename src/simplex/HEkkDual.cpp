@@ -1458,6 +1458,9 @@ void HEkkDual::chooseRow() {
         computed_edge_weight = edge_weight[row_out] =
             simplex_nla->rowEp2NormInScaledSpace(row_out, row_ep);
       }
+      // The merit of the row has changed, so it may be in the wrong
+      // CHUZR bucket
+      dualRHS.updateInfeasBucket(row_out);
       // If the weight error is acceptable then break out of the
       // loop. All we worry about is accepting rows with weights
       // which are not too small, since this can make the row look
@@ -1820,10 +1823,13 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
   }
   analysis->simplexTimerStart(PriceChuzc1Clock);
   // Row_ep:         PACK + CC1
-
+  //
+  // Long rows are packed, and their BFRT candidates found, in
+  // parallel chunks
+  const bool run_parallel = true;
   highs::parallel::spawn([&]() {
-    dualRow.chooseMakepack(row_ep, solver_num_col);
-    dualRow.choosePossible();
+    dualRow.chooseMakepack(row_ep, solver_num_col, run_parallel);
+    dualRow.choosePossible(run_parallel);
   });
 
   // Row_ap: PRICE + PACK + CC1
@@ -1849,8 +1855,9 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
 
       slice_dualRow[i].clear();
       slice_dualRow[i].workDelta = delta_primal;
-      slice_dualRow[i].chooseMakepack(&slice_row_ap[i], slice_start[i]);
-      slice_dualRow[i].choosePossible();
+      slice_dualRow[i].chooseMakepack(&slice_row_ap[i], slice_start[i],
+                                      run_parallel);
+      slice_dualRow[i].choosePossible(run_parallel);
     }
   });
 
@@ -2080,12 +2087,13 @@ void HEkkDual::updateDual() {
     // Update the whole vector of dual values
     //    debugUpdatedObjectiveValue(ekk_instance_, algorithm, solve_phase,
     //    "Before calling dualRow.updateDual");
-    dualRow.updateDual(theta_dual);
     if (ekk_instance_.info_.simplex_strategy != kSimplexStrategyDualPlain &&
         slice_PRICE) {
-      // Update the slice-by-slice copy of dual variables
-      for (HighsInt i = 0; i < slice_num; i++)
-        slice_dualRow[i].updateDual(theta_dual);
+      // Update the dual values for the row_ep part of the pivotal row
+      // and the slice-by-slice copy of its row_ap part
+      updateDualSlices();
+    } else {
+      dualRow.updateDual(theta_dual);
     }
     //    debugUpdatedObjectiveValue(ekk_instance_, algorithm, solve_phase,
     //    "After calling dualRow.updateDual");
@@ -2126,6 +2134,33 @@ void HEkkDual::updateDual() {
   //  shift_back");
 }
 
+void HEkkDual::updateDualSlices() {
+  // The indices packed in dualRow and the slices are disjoint, so
+  // they can be updated in parallel. The changes in the dual
+  // objective value are accumulated in the same order as when
+  // updating serially, so the result is independent of the threads
+  analysis->simplexTimerStart(UpdateDualClock);
+  std::vector<double> dual_objective_value_change(slice_num + 1);
+  auto updateSlices = [&](const HighsInt from_slice, const HighsInt to_slice) {
+    for (HighsInt i = from_slice; i < to_slice; i++) {
+      HEkkDualRow& row = i == 0 ? dualRow : slice_dualRow[i - 1];
+      dual_objective_value_change[i] = row.updateDualValues(theta_dual);
+    }
+  };
+  HighsInt pack_count = dualRow.packCount;
+  for (HighsInt i = 0; i < slice_num; i++)
+    pack_count += slice_dualRow[i].packCount;
+  if (pack_count > kDualRowChunkSize) {
+    highs::parallel::for_each(0, slice_num + 1, updateSlices);
+  } else {
+    updateSlices(0, slice_num + 1);
+  }
+  for (HighsInt i = 0; i <= slice_num; i++)
+    ekk_instance_.info_.updated_dual_objective_value +=
+        dual_objective_value_change[i];
+  analysis->simplexTimerStop(UpdateDualClock);
+}
+
 void HEkkDual::updatePrimal(HVector* DSE_Vector) {
   // Update the primal values and any edge weights
   //
@@ -2291,6 +2326,9 @@ void HEkkDual::initialiseDevexFramework() {
   // this Devex framework, increment the number of Devex frameworks
   // and indicate that there's no need for a new Devex framework
   ekk_instance_.dual_edge_weight_.assign(solver_num_row, 1.0);
+  // The merits of all rows have changed, so the CHUZR buckets must be
+  // created again
+  dualRHS.createInfeasBuckets();
   num_devex_iterations = 0;
   new_devex_framework = false;
   minor_new_devex_framework = false;
@@ -225,6 +225,12 @@ class HEkkDual {
    */
   void updateDual();
 
+  /**
+   * @brief Update the dual values for the pivotal row in dualRow and
+   * the slices of it in slice_dualRow, in parallel
+   */
+  void updateDualSlices();
+
   /**
    * @brief Update the primal values and any edge weights
    */
@@ -342,10 +342,10 @@ void HEkkDual::minorUpdateDual() {
   if (theta_dual == 0) {
     shiftCost(variable_in, -workDual[variable_in]);
   } else {
-    dualRow.updateDual(theta_dual);
     if (slice_PRICE) {
-      for (HighsInt i = 0; i < slice_num; i++)
-        slice_dualRow[i].updateDual(theta_dual);
+      updateDualSlices();
+    } else {
+      dualRow.updateDual(theta_dual);
     }
   }
   workDual[variable_in] = 0;
@@ -11,6 +11,7 @@
 #include "simplex/HEkkDualRHS.h"
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <set>
@@ -24,11 +25,37 @@ using std::min;
 using std::nth_element;
 using std::pair;
 
+// Buckets of rows with primal infeasibilities are defined by the
+// exponent of their merit, with merits outside the range of exponents
+// put in the lowest or highest bucket
+const HighsInt kInfeasBucketMinExponent = -64;
+const HighsInt kInfeasBucketMaxExponent = 64;
+const HighsInt kNumInfeasBucket =
+    kInfeasBucketMaxExponent - kInfeasBucketMinExponent + 1;
+
+static HighsInt infeasBucket(const double merit) {
+  if (merit >= kHighsInf) return kNumInfeasBucket - 1;
+  int exponent;
+  std::frexp(merit, &exponent);
+  return std::max(kInfeasBucketMinExponent,
+                  std::min(kInfeasBucketMaxExponent, (HighsInt)exponent)) -
+         kInfeasBucketMinExponent;
+}
+
 void HEkkDualRHS::setup() {
   const HighsInt numRow = ekk_instance_.lp_.num_row_;
   workMark.resize(numRow);
   workIndex.resize(numRow);
   work_infeasibility.resize(numRow);
+  // The buckets are only used by chooseNormal, so can't be used by
+  // the multiple CHUZR of PAMI
+  allow_infeas_buckets =
+      ekk_instance_.info_.simplex_strategy != kSimplexStrategyDualMulti;
+  infeas_bucket_mode = false;
+  infeas_bucket_first.assign(kNumInfeasBucket, -1);
+  infeas_row_bucket.assign(numRow, -1);
+  infeas_row_next.resize(numRow);
+  infeas_row_last.resize(numRow);
   partNum = 0;
   partSwitch = 0;
   analysis = &ekk_instance_.analysis_;
@@ -54,7 +81,54 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
   }
 
   std::vector<double>& edge_weight = ekk_instance_.dual_edge_weight_;
-  if (workCount < 0) {
+  if (infeas_bucket_mode) {
+    // BUCKET mode: the best row is in the highest nonempty bucket. NB
+    // Must still call random_.integer to maintain sequence of random
+    // numbers
+    ekk_instance_.random_.integer(workCount);
+    while (infeas_bucket_top >= 0 &&
+           infeas_bucket_first[infeas_bucket_top] < 0)
+      infeas_bucket_top--;
+    double bestMerit = 0;
+    HighsInt bestIndex = -1;
+    HighsInt bucket = infeas_bucket_top;
+    while (bucket >= 0) {
+      bool scan_again = false;
+      HighsInt iRow = infeas_bucket_first[bucket];
+      while (iRow >= 0) {
+        const HighsInt next_row = infeas_row_next[iRow];
+        // The infeasibility of taboo rows is zero, but they remain in
+        // their bucket
+        if (work_infeasibility[iRow] > kHighsZero) {
+          const double myInfeas = work_infeasibility[iRow];
+          const double myWeight = edge_weight[iRow];
+          // The weight of a row may have been corrected since it was
+          // put in its bucket
+          const HighsInt my_bucket = infeasBucket(myInfeas / myWeight);
+          if (my_bucket != bucket) {
+            updateInfeasBucket(iRow);
+            if (my_bucket > bucket) {
+              bucket = my_bucket;
+              scan_again = true;
+              break;
+            }
+          } else if (bestMerit * myWeight < myInfeas) {
+            bestMerit = myInfeas / myWeight;
+            bestIndex = iRow;
+          }
+        }
+        iRow = next_row;
+      }
+      if (scan_again) {
+        bestMerit = 0;
+        bestIndex = -1;
+        continue;
+      }
+      if (bestIndex >= 0) break;
+      bucket--;
+    }
+    *chIndex = bestIndex;
+  } else if (workCount < 0) {
     // DENSE mode
     const HighsInt numRow = -workCount;
     HighsInt randomStart = ekk_instance_.random_.integer(numRow);
@@ -370,12 +444,28 @@ void HEkkDualRHS::updatePivots(const HighsInt iRow, const double value) {
     work_infeasibility[iRow] = primal_infeasibility * primal_infeasibility;
   else
     work_infeasibility[iRow] = fabs(primal_infeasibility);
+  updateInfeasBucket(iRow);
 }
 
 void HEkkDualRHS::updateInfeasList(HVector* column) {
   const HighsInt columnCount = column->count;
   const HighsInt* variable_index = column->index.data();
 
+  if (infeas_bucket_mode) {
+    // BUCKET mode: the merit of rows in the column, and no others,
+    // may have changed, unless the indices of the column are not
+    // known
+    analysis->simplexTimerStart(UpdatePrimalClock);
+    if (columnCount < 0) {
+      createInfeasBuckets();
+    } else {
+      for (HighsInt i = 0; i < columnCount; i++)
+        updateInfeasBucket(variable_index[i]);
+    }
+    analysis->simplexTimerStop(UpdatePrimalClock);
+    return;
+  }
+
   // DENSE mode: disabled
   if (workCount < 0) return;
 
@@ -450,8 +540,18 @@ void HEkkDualRHS::createInfeasList(double columnDensity) {
 
   // 2. See if it worth to try to go sparse
   //    (Many candidates, really sparse RHS)
+  //
+  //    If possible, maintain buckets of all the candidates, otherwise
+  //    maintain a list of those with the greatest merit
+  const bool go_hyper_sparse =
+      workCount > max(numRow * 0.01, 500.0) && columnDensity < 0.05;
+  infeas_bucket_mode = go_hyper_sparse && allow_infeas_buckets;
+  if (infeas_bucket_mode) {
+    createInfeasBuckets();
+    return;
+  }
   std::vector<double>& edge_weight = ekk_instance_.dual_edge_weight_;
-  if (workCount > max(numRow * 0.01, 500.0) && columnDensity < 0.05) {
+  if (go_hyper_sparse) {
     HighsInt icutoff = max(workCount * 0.001, 500.0);
     double maxMerit = 0;
     for (HighsInt iRow = 0, iPut = 0; iRow < numRow; iRow++)
@@ -497,6 +597,50 @@ void HEkkDualRHS::createInfeasList(double columnDensity) {
   }
 }
 
+void HEkkDualRHS::createInfeasBuckets() {
+  if (!infeas_bucket_mode) return;
+  const HighsInt numRow = ekk_instance_.lp_.num_row_;
+  fill_n(infeas_bucket_first.data(), kNumInfeasBucket, -1);
+  fill_n(infeas_row_bucket.data(), numRow, -1);
+  infeas_bucket_top = -1;
+  // In BUCKET mode, workCount is the number of rows in the buckets
+  workCount = 0;
+  workCutoff = 0;
+  for (HighsInt iRow = 0; iRow < numRow; iRow++) updateInfeasBucket(iRow);
+}
+
+void HEkkDualRHS::updateInfeasBucket(const HighsInt iRow) {
+  if (!infeas_bucket_mode) return;
+  HighsInt bucket = -1;
+  if (work_infeasibility[iRow] > kHighsZero)
+    bucket = infeasBucket(work_infeasibility[iRow] /
+                          ekk_instance_.dual_edge_weight_[iRow]);
+  const HighsInt from_bucket = infeas_row_bucket[iRow];
+  if (bucket == from_bucket) return;
+  if (from_bucket >= 0) {
+    // Remove the row from its bucket
+    const HighsInt last_row = infeas_row_last[iRow];
+    const HighsInt next_row = infeas_row_next[iRow];
+    if (last_row >= 0)
+      infeas_row_next[last_row] = next_row;
+    else
+      infeas_bucket_first[from_bucket] = next_row;
+    if (next_row >= 0) infeas_row_last[next_row] = last_row;
+    workCount--;
+  }
+  if (bucket >= 0) {
+    // Add the row to the start of its bucket
+    const HighsInt next_row = infeas_bucket_first[bucket];
+    infeas_row_last[iRow] = -1;
+    infeas_row_next[iRow] = next_row;
+    if (next_row >= 0) infeas_row_last[next_row] = iRow;
+    infeas_bucket_first[bucket] = iRow;
+    infeas_bucket_top = std::max(bucket, infeas_bucket_top);
+    workCount++;
+  }
+  infeas_row_bucket[iRow] = bucket;
+}
+
 void HEkkDualRHS::assessOptimality() {
   HighsInt num_work_infeasibilities = 0;
   double max_work_infeasibility = 0;
@@ -107,6 +107,18 @@ class HEkkDualRHS {
    */
   void createArrayOfPrimalInfeasibilities();
 
+  /**
+   * @brief Create the buckets of rows with primal infeasibilities,
+   * according to their merit, for hyper-sparse CHUZR
+   */
+  void createInfeasBuckets();
+
+  /**
+   * @brief Move a row to the bucket for its current merit, adding it
+   * to, or removing it from, the buckets if necessary
+   */
+  void updateInfeasBucket(const HighsInt iRow);
+
   void assessOptimality();
 
   // References:
@@ -122,6 +134,17 @@ class HEkkDualRHS {
       workIndex;  //!< List of rows with greatest primal infeasibilities
   std::vector<double> work_infeasibility;
 
+  // Rows with primal infeasibilities are held in linked lists of
+  // buckets, according to the exponent of their merit, so that CHUZR
+  // only needs to search the highest bucket
+  bool allow_infeas_buckets;  //!< Whether CHUZR can use the buckets
+  bool infeas_bucket_mode;    //!< Whether CHUZR is using the buckets
+  HighsInt infeas_bucket_top;  //!< Upper bound on the highest nonempty bucket
+  std::vector<HighsInt> infeas_bucket_first;
+  std::vector<HighsInt> infeas_row_bucket;
+  std::vector<HighsInt> infeas_row_next;
+  std::vector<HighsInt> infeas_row_last;
+
   HighsInt partNum;
   HighsInt partNumRow;
   HighsInt partNumCol;
@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include "../extern/pdqsort/pdqsort.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsCDouble.h"
@@ -60,7 +61,8 @@ void HEkkDualRow::clear() {
   workCount = 0;
 }
 
-void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset) {
+void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset,
+                                 const bool run_parallel) {
   /**
    * Pack the indices and values for the row
    *
@@ -69,15 +71,24 @@ void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset) {
   const HighsInt rowCount = row->count;
   const HighsInt* rowIndex = row->index.data();
   const double* rowArray = row->array.data();
-  for (HighsInt i = 0; i < rowCount; i++) {
-    const HighsInt index = rowIndex[i];
-    const double value = rowArray[index];
-    packIndex[packCount] = index + offset;
-    packValue[packCount++] = value;
+  HighsInt* pack_index = &packIndex[packCount];
+  double* pack_value = &packValue[packCount];
+  auto pack = [&](const HighsInt from_i, const HighsInt to_i) {
+    for (HighsInt i = from_i; i < to_i; i++) {
+      const HighsInt index = rowIndex[i];
+      pack_index[i] = index + offset;
+      pack_value[i] = rowArray[index];
+    }
+  };
+  if (run_parallel && rowCount > kDualRowChunkSize) {
+    highs::parallel::for_each(0, rowCount, pack, kDualRowChunkSize);
+  } else {
+    pack(0, rowCount);
   }
+  packCount += rowCount;
 }
 
-void HEkkDualRow::choosePossible() {
+void HEkkDualRow::choosePossible(const bool run_parallel) {
   /**
    * Determine the possible variables - candidates for CHUZC
    * TODO: Check with Qi what this is doing
@@ -90,15 +101,57 @@ void HEkkDualRow::choosePossible() {
   workTheta = kHighsInf;
   workCount = 0;
 
-  for (HighsInt i = 0; i < packCount; i++) {
-    const HighsInt iCol = packIndex[i];
-    const HighsInt move = workMove[iCol];
-    const double alpha = packValue[i] * move_out * move;
-    if (alpha > Ta) {
-      workData[workCount++] = make_pair(iCol, alpha);
-      const double relax = workDual[iCol] * move + Td;
-      if (workTheta * alpha > relax) workTheta = relax / alpha;
+  if (!run_parallel || packCount <= kDualRowChunkSize) {
+    for (HighsInt i = 0; i < packCount; i++) {
+      const HighsInt iCol = packIndex[i];
+      const HighsInt move = workMove[iCol];
+      const double alpha = packValue[i] * move_out * move;
+      if (alpha > Ta) {
+        workData[workCount++] = make_pair(iCol, alpha);
+        const double relax = workDual[iCol] * move + Td;
+        if (workTheta * alpha > relax) workTheta = relax / alpha;
+      }
     }
+    return;
+  }
+
+  // Find the candidates in each chunk of the packed row, storing
+  // them from the start of the chunk in workData, as there are no
+  // more candidates than entries. The candidates are then moved down
+  // to be contiguous, in the same order as when found serially, and
+  // workTheta is the least of the values for the chunks
+  const HighsInt num_chunk =
+      (packCount + kDualRowChunkSize - 1) / kDualRowChunkSize;
+  std::vector<HighsInt> chunk_count(num_chunk);
+  std::vector<double> chunk_theta(num_chunk);
+  highs::parallel::for_each(
+      0, num_chunk, [&](const HighsInt from_chunk, const HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++) {
+          const HighsInt from_i = chunk * kDualRowChunkSize;
+          const HighsInt to_i = min(from_i + kDualRowChunkSize, packCount);
+          HighsInt count = from_i;
+          double theta = kHighsInf;
+          for (HighsInt i = from_i; i < to_i; i++) {
+            const HighsInt iCol = packIndex[i];
+            const HighsInt move = workMove[iCol];
+            const double alpha = packValue[i] * move_out * move;
+            if (alpha > Ta) {
+              workData[count++] = make_pair(iCol, alpha);
+              const double relax = workDual[iCol] * move + Td;
+              if (theta * alpha > relax) theta = relax / alpha;
+            }
+          }
+          chunk_count[chunk] = count - from_i;
+          chunk_theta[chunk] = theta;
+        }
+      });
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+    const HighsInt from_i = chunk * kDualRowChunkSize;
+    if (workCount < from_i)
+      std::copy(&workData[from_i], &workData[from_i] + chunk_count[chunk],
+                &workData[workCount]);
+    workCount += chunk_count[chunk];
+    workTheta = min(workTheta, chunk_theta[chunk]);
   }
 }
 
@@ -547,6 +600,11 @@ void HEkkDualRow::updateFlip(HVector* bfrtColumn) {
 
 void HEkkDualRow::updateDual(double theta) {
   analysis->simplexTimerStart(UpdateDualClock);
+  ekk_instance_.info_.updated_dual_objective_value += updateDualValues(theta);
+  analysis->simplexTimerStop(UpdateDualClock);
+}
+
+double HEkkDualRow::updateDualValues(const double theta) {
   double* workDual = ekk_instance_.info_.workDual_.data();
   double dual_objective_value_change = 0;
   for (HighsInt i = 0; i < packCount; i++) {
@@ -560,9 +618,7 @@ void HEkkDualRow::updateDual(double theta) {
     local_dual_objective_change *= ekk_instance_.cost_scale_;
     dual_objective_value_change += local_dual_objective_change;
   }
-  ekk_instance_.info_.updated_dual_objective_value +=
-      dual_objective_value_change;
-  analysis->simplexTimerStop(UpdateDualClock);
+  return dual_objective_value_change;
 }
 
 void HEkkDualRow::createFreelist() {
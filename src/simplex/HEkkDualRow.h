@@ -20,6 +20,11 @@
 const double kInitialTotalChange = 1e-12;
 const double kInitialRemainTheta = 1e100;
 const double kMaxSelectTheta = 1e18;
+// When packing the pivotal row and finding the BFRT candidates in
+// parallel, the packed row is processed in chunks of this size. The
+// chunks are independent of the number of threads, as are the
+// candidates found
+const HighsInt kDualRowChunkSize = 4096;
 
 /**
  * @brief Dual simplex ratio test for HiGHS
@@ -55,15 +60,19 @@ class HEkkDualRow {
    *
    * Offset of numCol is used when packing row_ep
    */
-  void chooseMakepack(const HVector* row,    //!< Row to be packed
-                      const HighsInt offset  //!< Offset for indices
+  void chooseMakepack(const HVector* row,     //!< Row to be packed
+                      const HighsInt offset,  //!< Offset for indices
+                      const bool run_parallel =
+                          false  //!< Pack chunks of the row in parallel
   );
   /**
    * @brief Determine the possible variables - candidates for CHUZC
    *
    * TODO: Check with Qi what this is doing
    */
-  void choosePossible();
+  void choosePossible(const bool run_parallel =
+                          false  //!< Search chunks of the row in parallel
+  );
 
   /**
    * @brief Join pack of possible candidates in this row with possible
@@ -113,6 +122,13 @@ class HEkkDualRow {
       double theta  //!< Multiple of pivotal row to add HighsInt to duals
                     //      HighsInt variable_out  //!< Index of leaving column
   );
+  /**
+   * @brief Update the dual values, returning the change in the dual
+   * objective value. Doesn't use the simplex timers, so can be called
+   * for several slices in parallel
+   */
+  double updateDualValues(const double theta  //!< Multiple of pivotal row
+  );
   /**
    * @brief Create a list of nonbasic free columns
    */
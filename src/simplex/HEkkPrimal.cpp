@@ -11,6 +11,7 @@
 #include "simplex/HEkkPrimal.h"
 
 #include "../extern/pdqsort/pdqsort.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsSort.h"
@@ -376,6 +377,69 @@ void HEkkPrimal::initialiseInstance() {
       ekk_instance_.options_->log_options.log_stream, debug);
 }
 
+void HEkkPrimal::initialiseInstanceParallel() {
+  // Identify the (current) number of HiGHS tasks to be used, with one
+  // slice of the matrix and variables for each. There's no point in
+  // slicing if there are fewer columns than tasks.
+  const HighsInt num_concurrency = ekk_instance_.info_.num_concurrency;
+  if (num_col < num_concurrency) return;
+  initSlice(num_concurrency);
+}
+
+void HEkkPrimal::initSlice(const HighsInt initial_num_slice) {
+  // Number of slices
+  slice_num = initial_num_slice;
+  if (slice_num < 1) slice_num = 1;
+  assert(slice_num <= kSimplexConcurrencyLimit);
+  if (slice_num > kSimplexConcurrencyLimit) {
+    highsLogDev(ekk_instance_.options_->log_options, HighsLogType::kWarning,
+                "WARNING: %" HIGHSINT_FORMAT
+                " = slice_num > kSimplexConcurrencyLimit = %" HIGHSINT_FORMAT
+                " so truncating "
+                "slice_num\n",
+                slice_num, kSimplexConcurrencyLimit);
+    slice_num = kSimplexConcurrencyLimit;
+  }
+
+  // Alias to the matrix
+  const HighsSparseMatrix& a_matrix = ekk_instance_.lp_.a_matrix_;
+  const HighsInt* Astart = a_matrix.start_.data();
+  const HighsInt AcountX = Astart[num_col];
+
+  // Figure out partition weight
+  double sliced_countX = AcountX / (double)slice_num;
+  slice_start[0] = 0;
+  for (HighsInt i = 0; i < slice_num - 1; i++) {
+    HighsInt endColumn = slice_start[i] + 1;  // At least one column
+    HighsInt endX = Astart[endColumn];
+    HighsInt stopX = (i + 1) * sliced_countX;
+    while (endX < stopX) {
+      endX = Astart[++endColumn];
+    }
+    slice_start[i + 1] = endColumn;
+    if (endColumn >= num_col) {
+      slice_num = i + 1;  // SHRINK
+      break;
+    }
+  }
+  slice_start[slice_num] = num_col;
+
+  // Partition the matrix and row_ap
+  for (HighsInt i = 0; i < slice_num; i++) {
+    HighsInt from_col = slice_start[i];
+    HighsInt to_col = slice_start[i + 1] - 1;
+    HighsInt slice_num_col = slice_start[i + 1] - from_col;
+    slice_a_matrix[i].createSlice(a_matrix, from_col, to_col);
+    slice_ar_matrix[i].createRowwise(slice_a_matrix[i]);
+    slice_row_ap[i].setup(slice_num_col);
+  }
+
+  // The cost of CHUZC is the same for each variable, so partition
+  // the variables evenly
+  for (HighsInt i = 0; i <= slice_num; i++)
+    slice_chuzc_start[i] = (HighsInt)(((int64_t)i * num_tot) / slice_num);
+}
+
 void HEkkPrimal::initialiseSolve() {
   // Copy values of simplex solver options to dual simplex options
   primal_feasibility_tolerance =
@@ -1052,14 +1116,18 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
       }
     }
     // Now look at other columns
-    for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
-      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
-      if (dual_infeasibility > dual_feasibility_tolerance &&
-          dual_infeasibility * dual_infeasibility >
-              best_measure * edge_weight_[iCol]) {
-        variable_in = iCol;
-        best_measure =
-            dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
+    if (slice_num > 1) {
+      chooseColumnSlice(best_measure);
+    } else {
+      for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
+        double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+        if (dual_infeasibility > dual_feasibility_tolerance &&
+            dual_infeasibility * dual_infeasibility >
+                best_measure * edge_weight_[iCol]) {
+          variable_in = iCol;
+          best_measure =
+              dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
+        }
       }
     }
     analysis->simplexTimerStop(ChuzcPrimalClock);
@@ -1069,6 +1137,42 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
   //	 ekk_instance_.iteration_count_, variable_in, best_measure);
 }
 
+void HEkkPrimal::chooseColumnSlice(double& best_measure) {
+  // Perform CHUZC over the slices of the variables in parallel. Each
+  // slice starts from the best measure of the nonbasic free columns,
+  // and the slice results are combined in slice order so that the
+  // variable chosen is independent of the number of threads
+  const vector<int8_t>& nonbasicMove = ekk_instance_.basis_.nonbasicMove_;
+  const vector<double>& workDual = ekk_instance_.info_.workDual_;
+  const double initial_best_measure = best_measure;
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) {
+      HighsInt slice_variable_in = -1;
+      double slice_best_measure = initial_best_measure;
+      for (HighsInt iCol = slice_chuzc_start[i];
+           iCol < slice_chuzc_start[i + 1]; iCol++) {
+        double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+        if (dual_infeasibility > dual_feasibility_tolerance &&
+            dual_infeasibility * dual_infeasibility >
+                slice_best_measure * edge_weight_[iCol]) {
+          slice_variable_in = iCol;
+          slice_best_measure =
+              dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
+        }
+      }
+      slice_chuzc_variable_in[i] = slice_variable_in;
+      slice_chuzc_measure[i] = slice_best_measure;
+    }
+  });
+  for (HighsInt i = 0; i < slice_num; i++) {
+    if (slice_chuzc_variable_in[i] >= 0 &&
+        slice_chuzc_measure[i] > best_measure) {
+      variable_in = slice_chuzc_variable_in[i];
+      best_measure = slice_chuzc_measure[i];
+    }
+  }
+}
+
 bool HEkkPrimal::useVariableIn() {
   // rebuild_reason = kRebuildReasonPossiblySingularBasis is set if
   // numerical trouble is detected
@@ -1406,8 +1510,12 @@ void HEkkPrimal::assessPivot() {
   //
   // PRICE
   //
-  const bool quad_precision = false;
-  ekk_instance_.tableauRowPrice(quad_precision, row_ep, row_ap);
+  if (slice_num > 1) {
+    tableauRowPriceSlice();
+  } else {
+    const bool quad_precision = false;
+    ekk_instance_.tableauRowPrice(quad_precision, row_ep, row_ap);
+  }
 
   // Checks row-wise pivot against column-wise pivot for
   // numerical trouble
@@ -1417,6 +1525,81 @@ void HEkkPrimal::assessPivot() {
   updateVerify();
 }
 
+void HEkkPrimal::tableauRowPriceSlice() {
+  // Perform PRICE over the slices of the matrix in parallel, scattering
+  // the results into row_ap. Since the slices aren't maintained as
+  // nonbasic partitions, components for basic variables are zeroed
+  analysis->simplexTimerStart(PriceClock);
+  HighsSimplexInfo& info = ekk_instance_.info_;
+  const int8_t* nonbasicFlag = ekk_instance_.basis_.nonbasicFlag_.data();
+  const double local_density = 1.0 * row_ep.count / num_row;
+  bool use_col_price;
+  bool use_row_price_w_switch;
+  ekk_instance_.choosePriceTechnique(info.price_strategy, local_density,
+                                     use_col_price, use_row_price_w_switch);
+  if (analysis->analyse_simplex_summary_data) {
+    if (use_col_price) {
+      const double expected_density = 1;
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      expected_density);
+      analysis->num_col_price++;
+    } else if (use_row_price_w_switch) {
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      info.row_ap_density);
+      analysis->num_row_price_with_switch++;
+    } else {
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      info.row_ap_density);
+      analysis->num_row_price++;
+    }
+  }
+  row_ap.clear();
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    const bool quad_precision = false;
+    for (HighsInt i = start; i < end; i++) {
+      HVector& local_row_ap = slice_row_ap[i];
+      local_row_ap.clear();
+      if (use_col_price) {
+        // Perform column-wise PRICE
+        slice_a_matrix[i].priceByColumn(quad_precision, local_row_ap, row_ep);
+      } else if (use_row_price_w_switch) {
+        // Perform hyper-sparse row-wise PRICE, but switch if the density of
+        // row_ap becomes extreme
+        slice_ar_matrix[i].priceByRowWithSwitch(
+            quad_precision, local_row_ap, row_ep, info.row_ap_density, 0,
+            kHyperPriceDensity);
+      } else {
+        // Perform hyper-sparse row-wise PRICE
+        slice_ar_matrix[i].priceByRow(quad_precision, local_row_ap, row_ep);
+      }
+      // The slices of row_ap.array are disjoint, so can be assigned
+      // here
+      const HighsInt from_col = slice_start[i];
+      for (HighsInt iEl = 0; iEl < local_row_ap.count; iEl++) {
+        const HighsInt iCol = local_row_ap.index[iEl];
+        row_ap.array[from_col + iCol] =
+            nonbasicFlag[from_col + iCol] * local_row_ap.array[iCol];
+      }
+    }
+  });
+  // Join the indices of the slices of row_ap
+  HighsInt row_ap_count = 0;
+  for (HighsInt i = 0; i < slice_num; i++) {
+    const HighsInt from_col = slice_start[i];
+    const HVector& local_row_ap = slice_row_ap[i];
+    for (HighsInt iEl = 0; iEl < local_row_ap.count; iEl++)
+      row_ap.index[row_ap_count++] = from_col + local_row_ap.index[iEl];
+  }
+  row_ap.count = row_ap_count;
+  // Update the record of average row_ap density
+  const double local_row_ap_density = (double)row_ap.count / num_col;
+  ekk_instance_.updateOperationResultDensity(local_row_ap_density,
+                                             info.row_ap_density);
+  if (analysis->analyse_simplex_summary_data)
+    analysis->operationRecordAfter(kSimplexNlaPriceAp, row_ap);
+  analysis->simplexTimerStop(PriceClock);
+}
+
 void HEkkPrimal::update() {
   // Perform update operations that are independent of phase
   HighsSimplexInfo& info = ekk_instance_.info_;
@@ -1482,16 +1665,21 @@ void HEkkPrimal::update() {
   // phase 2 if a primal infeasibility is found
   considerInfeasibleValueIn();
 
-  // Update the dual values
+  // Update the dual values and any non-unit primal edge weights
   theta_dual = info.workDual_[variable_in];
-  updateDual();
-
-  // Update any non-unit primal edge weights
-  if (edge_weight_mode == EdgeWeightMode::kDevex) {
-    updateDevex();
-  } else if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
+  if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
     debugPrimalSteepestEdgeWeights("before update");
-    updatePrimalSteepestEdgeWeights();
+  if (slice_num > 1) {
+    // The dual update and edge weight update are independent, so
+    // can be performed concurrently. In particular, the BTRAN of the
+    // FTRANned entering column for primal steepest edge overlaps
+    // with the update of the duals
+    highs::parallel::spawn([&]() { updateDual(); });
+    updateEdgeWeight();
+    highs::parallel::sync();
+  } else {
+    updateDual();
+    updateEdgeWeight();
   }
 
   // If entering column was nonbasic free, remove it from the set
@@ -1547,6 +1735,14 @@ void HEkkPrimal::update() {
   hyperChooseColumn();
 }
 
+void HEkkPrimal::updateEdgeWeight() {
+  if (edge_weight_mode == EdgeWeightMode::kDevex) {
+    updateDevex();
+  } else if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
+    updatePrimalSteepestEdgeWeights();
+  }
+}
+
 void HEkkPrimal::hyperChooseColumn() {
   if (!use_hyper_chuzc) return;
   if (initialise_hyper_chuzc) return;
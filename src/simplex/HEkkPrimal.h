@@ -26,7 +26,12 @@ const SimplexAlgorithm algorithm = SimplexAlgorithm::kPrimal;
 
 class HEkkPrimal {
  public:
-  HEkkPrimal(HEkk& simplex) : ekk_instance_(simplex) { initialiseInstance(); }
+  HEkkPrimal(HEkk& simplex) : ekk_instance_(simplex) {
+    initialiseInstance();
+    if (ekk_instance_.info_.simplex_strategy == kSimplexStrategyPrimal &&
+        ekk_instance_.info_.num_concurrency > 1)
+      initialiseInstanceParallel();
+  }
   /**
    * @brief Solve a model instance
    */
@@ -37,6 +42,11 @@ class HEkkPrimal {
    * @brief Initialise a primal simplex instance
    */
   void initialiseInstance();
+  /**
+   * @brief Initialise the column slices for parallel PRICE and CHUZC
+   */
+  void initialiseInstanceParallel();
+  void initSlice(const HighsInt initial_num_slice);
   /**
    * @brief Initialise a primal simplex solve
    */
@@ -49,16 +59,19 @@ class HEkkPrimal {
   void iterate();
   void chuzc();
   void chooseColumn(const bool hyper_sparse = false);
+  void chooseColumnSlice(double& best_measure);
   bool useVariableIn();
   void phase1ChooseRow();
   void chooseRow();
 
   void considerBoundSwap();
   void assessPivot();
+  void tableauRowPriceSlice();
 
   void update();
 
   void updateDual();
+  void updateEdgeWeight();
 
   void hyperChooseColumn();
   void hyperChooseColumnStart();
@@ -176,6 +189,17 @@ class HEkkPrimal {
   HVector col_steepest_edge;
   HighsRandom random_;  // Just for checking PSE weights
 
+  // Partitioned coefficient matrix for parallel PRICE, and partition
+  // of the variables for parallel CHUZC
+  HighsInt slice_num = 0;
+  HighsInt slice_start[kSimplexConcurrencyLimit + 1];
+  HighsSparseMatrix slice_a_matrix[kSimplexConcurrencyLimit];
+  HighsSparseMatrix slice_ar_matrix[kSimplexConcurrencyLimit];
+  HVector slice_row_ap[kSimplexConcurrencyLimit];
+  HighsInt slice_chuzc_start[kSimplexConcurrencyLimit + 1];
+  HighsInt slice_chuzc_variable_in[kSimplexConcurrencyLimit];
+  double slice_chuzc_measure[kSimplexConcurrencyLimit];
+
   double max_max_local_primal_infeasibility_;
   double max_max_ignored_violation_;
   double max_max_primal_correction_;
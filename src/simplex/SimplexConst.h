@@ -139,6 +139,7 @@ enum class EdgeWeightMode { kDantzig = 0, kDevex, kSteepestEdge, kCount };
 
 const HighsInt kDualTasksMinConcurrency = 3;
 const HighsInt kDualMultiMinConcurrency = 1;  // 2;
+const HighsInt kPrimalTasksMinConcurrency = 2;
 
 // Simplex nonbasicFlag status for columns and rows. Don't use enum
 // class since they are used as HighsInt to replace conditional
@@ -15,10 +15,12 @@
 
 #include "../extern/pdqsort/pdqsort.h"
 #include "lp_data/HConst.h"
+#include "parallel/HighsParallel.h"
 #include "util/FactorTimer.h"
 #include "util/HFactorDebug.h"
 #include "util/HVector.h"
 #include "util/HVectorBase.h"
+#include "util/HighsSimd.h"
 #include "util/HighsTimer.h"
 
 // std::vector, std::max and std::min used in HFactor.h for local
@@ -220,6 +222,9 @@ void HFactor::setupGeneral(
       max(kMinPivotTolerance, min(pivot_tolerance_, kMaxPivotTolerance));
   highs_debug_level = highs_debug_level_;
   time_limit_ = kHighsInf;
+  kernel_dense_min_dim_ = kBuildKernelDenseMinDim;
+  kernel_dense_min_density_ = kBuildKernelDenseMinDensity;
+  kernel_blocks_ = true;
   log_data = decltype(log_data)(new LogData());
   log_options.output_flag = &log_data->output_flag;
   log_options.log_to_console = &log_data->log_to_console;
@@ -543,6 +548,19 @@ void HFactor::setTimeLimit(const double time_limit) {
   this->time_limit_ = time_limit;
 }
 
+bool HFactor::useParallel() const {
+  // The task executor is only available if it's been initialized on
+  // this thread
+  return HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+         highs::parallel::num_threads() > 1;
+}
+
+void HFactor::setKernelDense(const HighsInt min_dim,
+                             const double min_density) {
+  this->kernel_dense_min_dim_ = min_dim;
+  this->kernel_dense_min_density_ = min_density;
+}
+
 void HFactor::luClear() {
   l_start.clear();
   l_start.push_back(0);
@@ -555,6 +573,9 @@ void HFactor::luClear() {
   u_start.push_back(0);
   u_index.clear();
   u_value.clear();
+
+  kernel_block_start.clear();
+  kernel_row_block.clear();
 }
 
 void HFactor::buildSimple() {
@@ -620,9 +641,7 @@ void HFactor::buildSimple() {
         pivot_type = kPivotLogical;
         iRow = lc_iRow;
       } else {
-        mr_count_before[lc_iRow]++;
-        b_index[BcountX] = lc_iRow;
-        b_value[BcountX++] = 1.0;
+        BcountX++;
         iwork[nwork++] = iCol;
       }
     } else {
@@ -648,12 +667,8 @@ void HFactor::buildSimple() {
         pivot_type = kPivotColSingleton;  //;kPivotUnit;//
         iRow = a_index[start];
       } else {
-        for (HighsInt k = start; k < start + count; k++) {
-          mr_count_before[a_index[k]]++;
-          assert(BcountX < (HighsInt)b_index.size());
-          b_index[BcountX] = a_index[k];
-          b_value[BcountX++] = a_value[k];
-        }
+        BcountX += count;
+        assert(BcountX <= (HighsInt)b_index.size());
         iwork[nwork++] = iCol;
       }
     }
@@ -677,6 +692,34 @@ void HFactor::buildSimple() {
     b_start[iCol + 1] = BcountX;
     b_var[iCol] = iMat;
   }
+  // 1.4 Copy the non-unit columns into the basis matrix, in parallel
+  // for large bases, and then count the entries in each row. Until
+  // now, mr_count_before has only been used to identify rows with
+  // pivots, which are negative and remain so.
+  auto copyColumns = [&](HighsInt from_k, HighsInt to_k) {
+    for (HighsInt k = from_k; k < to_k; k++) {
+      const HighsInt iCol = iwork[k];
+      const HighsInt iMat = b_var[iCol];
+      HighsInt iPut = b_start[iCol];
+      if (iMat >= num_col) {
+        b_index[iPut] = iMat - num_col;
+        b_value[iPut] = 1.0;
+      } else {
+        for (HighsInt iEl = a_start[iMat]; iEl < a_start[iMat + 1]; iEl++) {
+          b_index[iPut] = a_index[iEl];
+          b_value[iPut++] = a_value[iEl];
+        }
+      }
+    }
+  };
+  if (BcountX >= kBuildSimpleParallelMinCount && useParallel()) {
+    const HighsInt grain_size =
+        max(HighsInt{1}, nwork / (4 * highs::parallel::num_threads()));
+    highs::parallel::for_each(0, nwork, copyColumns, grain_size);
+  } else {
+    copyColumns(0, nwork);
+  }
+  for (HighsInt k = 0; k < BcountX; k++) mr_count_before[b_index[k]]++;
   // Record the number of elements in the basis matrix
   basis_matrix_num_el = num_row - nwork + BcountX;
 
@@ -884,12 +927,54 @@ HighsInt HFactor::buildKernel() {
   const bool check_for_timeout = this->time_limit_ < kHighsInf;
   HighsInt search_k = 0;
 
+  // Factor the kernel as independent blocks if possible
+  const HighsInt build_blocks_return = buildKernelBlocks();
+  if (build_blocks_return != kBuildKernelReturnNoBlocks)
+    return build_blocks_return;
+
+  // Order the kernel in block triangular form. If it has more than
+  // one diagonal block, the pivots are chosen from one block at a
+  // time, so only the columns and rows of the blocks that have been
+  // activated are in the count link lists
+  vector<HighsInt> btf_block_start;
+  vector<HighsInt> btf_block_col;
+  vector<HighsInt> btf_block_row;
+  vector<HighsInt> btf_col_block;
+  const HighsInt num_btf_block = buildKernelBtf(
+      btf_block_start, btf_block_col, btf_block_row, btf_col_block);
+  const bool use_btf = num_btf_block > 1;
+  HighsInt btf_block = -1;
+  // Number of columns of the activated blocks yet to be pivoted on
+  HighsInt btf_num_active_col = 0;
+  // L is block diagonal within the kernel if each block is fully
+  // factored before the next is activated
+  bool btf_blocks_complete = use_btf;
+  vector<HighsInt> btf_pivot_start;
+  auto activateBtfBlock = [&]() {
+    btf_block++;
+    btf_pivot_start.push_back(l_start.size() - 1);
+    for (HighsInt k = btf_block_start[btf_block];
+         k < btf_block_start[btf_block + 1]; k++) {
+      clinkAdd(btf_block_col[k], mc_count_a[btf_block_col[k]]);
+      rlinkAdd(btf_block_row[k], mr_count[btf_block_row[k]]);
+    }
+    btf_num_active_col +=
+        btf_block_start[btf_block + 1] - btf_block_start[btf_block];
+  };
+  if (use_btf) {
+    col_link_first.assign(num_row + 1, -1);
+    row_link_first.assign(num_basic + 1, -1);
+    activateBtfBlock();
+  }
+
   const HighsInt check_nwork = -11;
   while (nwork-- > 0) {
     //    printf("\nnwork = %d\n", (int)nwork);
     if (nwork == check_nwork) {
       reportAsm();
     }
+    if (use_btf && btf_num_active_col == 0 && btf_block < num_btf_block - 1)
+      activateBtfBlock();
     // Determine whether to return due to exceeding the time limit
     if (check_for_timeout && search_k % timer_frequency == 0) {
       double current_time = build_timer_->readRunHighsClock();
@@ -908,6 +993,18 @@ HighsInt HFactor::buildKernel() {
           total_time_bound > this->time_limit_)
         return kBuildKernelReturnTimeout;
     }
+    // Once the active part of the kernel is dense, complete the
+    // factorization with dense LU. With block triangular form, all
+    // the remaining columns must be active
+    if ((!use_btf || btf_block == num_btf_block - 1) &&
+        kernelIsDense(nwork + 1)) {
+      build_synthetic_tick +=
+          fake_search * 20 + fake_fill * 160 + fake_eliminate * 80;
+      const HighsInt build_dense_return = buildKernelDense(nwork + 1);
+      if (btf_blocks_complete && build_dense_return == 0)
+        setKernelBlocks(btf_pivot_start, btf_block_start, btf_block_row);
+      return build_dense_return;
+    }
 
     /**
      * 1. Search for the pivot
@@ -916,7 +1013,11 @@ HighsInt HFactor::buildKernel() {
     HighsInt iRowPivot = -1;
     //    int8_t pivot_type = kPivotIllegal;
     // 1.1. Setup search merits
-    HighsInt searchLimit = min(nwork, HighsInt{8});
+    //
+    // With block triangular form, only the columns of the active
+    // blocks can be pivotal, so limit the search accordingly
+    HighsInt searchLimit =
+        min(use_btf ? btf_num_active_col : nwork, HighsInt{8});
     HighsInt searchCount = 0;
 
     double merit_limit = 1.0 * num_basic * num_row;
@@ -955,9 +1056,14 @@ HighsInt HFactor::buildKernel() {
       iRowPivot = mc_index[mc_start[jColPivot]];
       foundPivot = true;
     }
-    if (!foundPivot && row_link_first[1] != -1) {
-      iRowPivot = row_link_first[1];
-      jColPivot = mr_index[mr_start[iRowPivot]];
+    for (HighsInt i = row_link_first[1]; !foundPivot && i != -1;
+         i = row_link_next[i]) {
+      // With block triangular form, the entry may be in a column of a
+      // block that's not active
+      const HighsInt j = mr_index[mr_start[i]];
+      if (use_btf && btf_col_block[j] > btf_block) continue;
+      iRowPivot = i;
+      jColPivot = j;
       foundPivot = true;
     }
     const bool singleton_pivot = foundPivot;
@@ -1012,6 +1118,7 @@ HighsInt HFactor::buildKernel() {
           HighsInt end = start + mr_count[i];
           for (HighsInt k = start; k < end; k++) {
             HighsInt j = mr_index[k];
+            if (use_btf && btf_col_block[j] > btf_block) continue;
             HighsInt column_count = mc_count_a[j];
             double merit_local = 1.0 * (count - 1) * (column_count - 1);
             if (merit_local < merit_pivot) {
@@ -1043,6 +1150,14 @@ HighsInt HFactor::buildKernel() {
       // jColPivot is (still) -1 and foundPivot is false
       assert(jColPivot < 0);
       assert(!foundPivot);
+      if (use_btf && btf_block < num_btf_block - 1) {
+        // The active blocks are singular, but the remaining blocks
+        // may yield pivots
+        btf_blocks_complete = false;
+        activateBtfBlock();
+        nwork++;
+        continue;
+      }
       rank_deficiency = nwork + 1;
       highsLogDev(log_options, HighsLogType::kWarning,
                   "Factorization identifies rank deficiency of %d\n",
@@ -1092,6 +1207,7 @@ HighsInt HFactor::buildKernel() {
         // Otherwise, other entries in the pivotal column will be
         // smaller than the pivot, so zero the column
         zeroCol(jColPivot);
+        if (use_btf) btf_num_active_col--;
         // Add the pivotal row to the linked list of rows with its new
         // count
         assert(mr_count[iRowPivot] == original_pivotal_row_count - 1);
@@ -1103,6 +1219,7 @@ HighsInt HFactor::buildKernel() {
     }
     permute[jColPivot] = iRowPivot;
     assert(mc_var[jColPivot] == basic_index[jColPivot]);
+    if (use_btf) btf_num_active_col--;
 
     this->refactor_info_.pivot_row.push_back(iRowPivot);
     this->refactor_info_.pivot_var.push_back(basic_index[jColPivot]);
@@ -1235,7 +1352,8 @@ HighsInt HFactor::buildKernel() {
 
       // 2.4.6. Fix max value and link list
       colFixMax(iCol);
-      if (my_count != mc_count_a[iCol]) {
+      if (my_count != mc_count_a[iCol] &&
+          (!use_btf || btf_col_block[iCol] <= btf_block)) {
         clinkDel(iCol);
         clinkAdd(iCol, mc_count_a[iCol]);
       }
@@ -1256,6 +1374,8 @@ HighsInt HFactor::buildKernel() {
   }
   build_synthetic_tick +=
       fake_search * 20 + fake_fill * 160 + fake_eliminate * 80;
+  if (btf_blocks_complete)
+    setKernelBlocks(btf_pivot_start, btf_block_start, btf_block_row);
   rank_deficiency = 0;
   return rank_deficiency;
 }
@@ -1555,18 +1675,49 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
     const double* l_value = this->l_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
-    // Transform
-    for (HighsInt i = 0; i < num_row; i++) {
-      HighsInt pivotRow = l_pivot_index[i];
-      const double pivot_multiplier = rhs_array[pivotRow];
-      if (fabs(pivot_multiplier) > kHighsTiny) {
-        rhs_index[rhs_count++] = pivotRow;
-        const HighsInt start = l_start[i];
-        const HighsInt end = l_start[i + 1];
-        for (HighsInt k = start; k < end; k++)
-          rhs_array[l_index[k]] -= pivot_multiplier * l_value[k];
-      } else
-        rhs_array[pivotRow] = 0;
+    // Within the kernel blocks, L is block diagonal, so a block can
+    // be skipped if the RHS is zero in its rows. Use the zeroed
+    // rhs.cwork to mark the blocks with nonzeros in the RHS, or in the
+    // columns of L before the kernel that are applied
+    const HighsInt num_kernel_block = kernel_block_start.size() - 1;
+    const bool skip_kernel_blocks = num_kernel_block > 1 && rhs.count >= 0;
+    char* kernel_block_mark = rhs.cwork.data();
+    auto transform = [&](const HighsInt from_i, const HighsInt to_i,
+                         const bool mark_kernel_blocks) {
+      for (HighsInt i = from_i; i < to_i; i++) {
+        HighsInt pivotRow = l_pivot_index[i];
+        const double pivot_multiplier = rhs_array[pivotRow];
+        if (fabs(pivot_multiplier) > kHighsTiny) {
+          rhs_index[rhs_count++] = pivotRow;
+          const HighsInt start = l_start[i];
+          const HighsInt end = l_start[i + 1];
+          subtractMultiple(rhs_array, pivot_multiplier, &l_index[start],
+                           &l_value[start], end - start);
+          if (mark_kernel_blocks) {
+            for (HighsInt k = start; k < end; k++) {
+              const HighsInt iBlock = kernel_row_block[l_index[k]];
+              if (iBlock >= 0) kernel_block_mark[iBlock] = 1;
+            }
+          }
+        } else
+          rhs_array[pivotRow] = 0;
+      }
+    };
+    if (skip_kernel_blocks) {
+      assert(kernel_block_start[num_kernel_block] == num_row);
+      for (HighsInt k = 0; k < rhs.count; k++) {
+        const HighsInt iBlock = kernel_row_block[rhs_index[k]];
+        if (iBlock >= 0) kernel_block_mark[iBlock] = 1;
+      }
+      transform(0, kernel_block_start[0], true);
+      for (HighsInt iBlock = 0; iBlock < num_kernel_block; iBlock++) {
+        if (!kernel_block_mark[iBlock]) continue;
+        kernel_block_mark[iBlock] = 0;
+        transform(kernel_block_start[iBlock], kernel_block_start[iBlock + 1],
+                  false);
+      }
+    } else {
+      transform(0, num_row, false);
     }
     // Save the count
     rhs.count = rhs_count;
@@ -1603,19 +1754,42 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
     const double* lr_value = this->lr_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
-    // Transform
-    for (HighsInt i = num_row - 1; i >= 0; i--) {
-      HighsInt pivotRow = l_pivot_index[i];
-      const double pivot_multiplier = rhs_array[pivotRow];
-      if (fabs(pivot_multiplier) > kHighsTiny) {
-        rhs_index[rhs_count++] = pivotRow;
-        rhs_array[pivotRow] = pivot_multiplier;
-        const HighsInt start = lr_start[i];
-        const HighsInt end = lr_start[i + 1];
-        for (HighsInt k = start; k < end; k++)
-          rhs_array[lr_index[k]] -= pivot_multiplier * lr_value[k];
-      } else
-        rhs_array[pivotRow] = 0;
+    // Within the kernel blocks, L is block diagonal, and the kernel is
+    // transformed first, so a block can be skipped if the RHS is zero
+    // in its rows. Use the zeroed rhs.cwork to mark the blocks with
+    // nonzeros in the RHS
+    const HighsInt num_kernel_block = kernel_block_start.size() - 1;
+    const bool skip_kernel_blocks = num_kernel_block > 1 && rhs.count >= 0;
+    char* kernel_block_mark = rhs.cwork.data();
+    auto transform = [&](const HighsInt from_i, const HighsInt to_i) {
+      for (HighsInt i = to_i - 1; i >= from_i; i--) {
+        HighsInt pivotRow = l_pivot_index[i];
+        const double pivot_multiplier = rhs_array[pivotRow];
+        if (fabs(pivot_multiplier) > kHighsTiny) {
+          rhs_index[rhs_count++] = pivotRow;
+          rhs_array[pivotRow] = pivot_multiplier;
+          const HighsInt start = lr_start[i];
+          const HighsInt end = lr_start[i + 1];
+          subtractMultiple(rhs_array, pivot_multiplier, &lr_index[start],
+                           &lr_value[start], end - start);
+        } else
+          rhs_array[pivotRow] = 0;
+      }
+    };
+    if (skip_kernel_blocks) {
+      assert(kernel_block_start[num_kernel_block] == num_row);
+      for (HighsInt k = 0; k < rhs.count; k++) {
+        const HighsInt iBlock = kernel_row_block[rhs_index[k]];
+        if (iBlock >= 0) kernel_block_mark[iBlock] = 1;
+      }
+      for (HighsInt iBlock = num_kernel_block - 1; iBlock >= 0; iBlock--) {
+        if (!kernel_block_mark[iBlock]) continue;
+        kernel_block_mark[iBlock] = 0;
+        transform(kernel_block_start[iBlock], kernel_block_start[iBlock + 1]);
+      }
+      transform(0, kernel_block_start[0]);
+    } else {
+      transform(0, num_row);
     }
     // Save the count
     rhs.count = rhs_count;
@@ -1707,8 +1881,8 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
         if (i_logic >= num_row) {
           rhs_synthetic_tick += (end - start);
         }
-        for (HighsInt k = start; k < end; k++)
-          rhs_array[u_index[k]] -= pivot_multiplier * u_value[k];
+        subtractMultiple(rhs_array, pivot_multiplier, &u_index[start],
+                         &u_value[start], end - start);
       } else
         rhs_array[pivotRow] = 0;
     }
@@ -1805,8 +1979,8 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
         if (i_logic >= num_row) {
           rhs_synthetic_tick += (end - start);
         }
-        for (HighsInt k = start; k < end; k++)
-          rhs_array[ur_index[k]] -= pivot_multiplier * ur_value[k];
+        subtractMultiple(rhs_array, pivot_multiplier, &ur_index[start],
+                         &ur_value[start], end - start);
       } else
         rhs_array[pivotRow] = 0;
     }
@@ -1860,11 +2034,10 @@ void HFactor::ftranFT(HVector& vector) const {
   for (HighsInt i = 0; i < pf_pivot_count; i++) {
     HighsInt iRow = pf_pivot_index[i];
     double value0 = rhs_array[iRow];
-    double value1 = value0;
     const HighsInt start = pf_start[i];
     const HighsInt end = pf_start[i + 1];
-    for (HighsInt k = start; k < end; k++)
-      value1 -= rhs_array[pf_index[k]] * pf_value[k];
+    double value1 = subtractDot(value0, rhs_array, &pf_index[start],
+                                &pf_value[start], end - start);
     // This would skip the situation where they are both zeros
     if (value0 || value1) {
       if (value0 == 0) rhs_index[rhs_count++] = iRow;
@@ -1900,13 +2073,8 @@ void HFactor::btranFT(HVector& vector) const {
       const HighsInt start = pf_start[i];
       const HighsInt end = pf_start[i + 1];
       rhs_synthetic_tick += (end - start);
-      for (HighsInt k = start; k < end; k++) {
-        HighsInt iRow = pf_index[k];
-        double value0 = rhs_array[iRow];
-        double value1 = value0 - pivot_multiplier * pf_value[k];
-        if (value0 == 0) rhs_index[rhs_count++] = iRow;
-        rhs_array[iRow] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-      }
+      subtractMultipleTrack(rhs_array, rhs_index, rhs_count, pivot_multiplier,
+                            &pf_index[start], &pf_value[start], end - start);
     }
   }
   vector.synthetic_tick += rhs_synthetic_tick * 15 + pf_pivot_count * 10;
@@ -1935,13 +2103,10 @@ void HFactor::ftranPF(HVector& vector) const {
     if (fabs(pivot_multiplier) > kHighsTiny) {
       pivot_multiplier /= pf_pivot_value[i];
       rhs_array[pivotRow] = pivot_multiplier;
-      for (HighsInt k = pf_start[i]; k < pf_start[i + 1]; k++) {
-        const HighsInt index = pf_index[k];
-        const double value0 = rhs_array[index];
-        const double value1 = value0 - pivot_multiplier * pf_value[k];
-        if (value0 == 0) rhs_index[rhs_count++] = index;
-        rhs_array[index] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-      }
+      const HighsInt start = pf_start[i];
+      const HighsInt end = pf_start[i + 1];
+      subtractMultipleTrack(rhs_array, rhs_index, rhs_count, pivot_multiplier,
+                            &pf_index[start], &pf_value[start], end - start);
     }
   }
 
@@ -1966,9 +2131,11 @@ void HFactor::btranPF(HVector& vector) const {
   // Backwardly
   for (HighsInt i = pf_pivot_count - 1; i >= 0; i--) {
     HighsInt pivotRow = pf_pivot_index[i];
-    double pivot_multiplier = rhs_array[pivotRow];
-    for (HighsInt k = pf_start[i]; k < pf_start[i + 1]; k++)
-      pivot_multiplier -= pf_value[k] * rhs_array[pf_index[k]];
+    const HighsInt start = pf_start[i];
+    const HighsInt end = pf_start[i + 1];
+    double pivot_multiplier =
+        subtractDot(rhs_array[pivotRow], rhs_array, &pf_index[start],
+                    &pf_value[start], end - start);
     pivot_multiplier /= pf_pivot_value[i];
 
     if (rhs_array[pivotRow] == 0) rhs_index[rhs_count++] = pivotRow;
@@ -2566,6 +2733,9 @@ void HFactor::setInvert(const InvertibleRepresentation& invert) {
   this->pf_value = invert.pf_value;
   this->pf_pivot_index = invert.pf_pivot_index;
   this->pf_pivot_value = invert.pf_pivot_value;
+
+  this->kernel_block_start.clear();
+  this->kernel_row_block.clear();
 }
 
 void InvertibleRepresentation::clear() {
@@ -28,6 +28,27 @@ using std::max;
 using std::vector;
 
 const HighsInt kBuildKernelReturnTimeout = -1;
+const HighsInt kBuildKernelReturnNoBlocks = -2;
+
+// The columns of the basis matrix are copied in parallel if it has at
+// least this many entries
+const HighsInt kBuildSimpleParallelMinCount = 100000;
+
+// The kernel is factored as independent blocks when its connected
+// components can be grouped into at least two blocks of at least
+// kBuildKernelBlockMinDim columns
+const HighsInt kBuildKernelBlockMinDim = 256;
+
+// The kernel is factored in block triangular form only if no diagonal
+// block has more than kBuildKernelBtfMaxBlockFraction of its columns
+const double kBuildKernelBtfMaxBlockFraction = 0.5;
+
+// Once the kernel has at least kBuildKernelDenseMinDim active
+// columns, and every active row and column has at least
+// kBuildKernelDenseMinDensity times this number of entries, it is
+// factored as a dense matrix
+const HighsInt kBuildKernelDenseMinDim = 100;
+const double kBuildKernelDenseMinDensity = 0.5;
 
 struct InvertibleRepresentation {
   // Factor L
@@ -122,6 +143,9 @@ class HFactor {
         pivot_tolerance(0.0),
         highs_debug_level(0),
         time_limit_(0.0),
+        kernel_dense_min_dim_(kBuildKernelDenseMinDim),
+        kernel_dense_min_density_(kBuildKernelDenseMinDensity),
+        kernel_blocks_(true),
         use_original_HFactor_logic(false),
         debug_report_(false),
         basis_matrix_limit_size(0),
@@ -246,6 +270,12 @@ class HFactor {
    */
   void setTimeLimit(const double time_limit);
 
+  /**
+   * @brief Sets the dimension and density of the active part of the
+   * kernel at which it is factored as a dense matrix
+   */
+  void setKernelDense(const HighsInt min_dim, const double min_density);
+
   /**
    * @brief Updates instance with respect to new columns in the
    * constraint matrix (assuming columns are nonbasic)
@@ -358,6 +388,9 @@ class HFactor {
   double pivot_tolerance;
   HighsInt highs_debug_level;
   double time_limit_;
+  HighsInt kernel_dense_min_dim_;
+  double kernel_dense_min_density_;
+  bool kernel_blocks_;
 
   struct LogData {
     bool output_flag;
@@ -431,6 +464,13 @@ class HFactor {
   vector<HighsInt> lr_index;
   vector<double> lr_value;
 
+  // Blocks of the kernel, within which L is block diagonal: the pivot
+  // at which each block starts, followed by the end of the kernel, and
+  // the block of each row (-1 if it's not in the kernel). Empty unless
+  // the kernel has been factored as at least two blocks
+  vector<HighsInt> kernel_block_start;
+  vector<HighsInt> kernel_row_block;
+
   // Factor U
   vector<HighsInt> u_pivot_lookup;
   vector<HighsInt> u_pivot_index;
@@ -461,12 +501,23 @@ class HFactor {
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  HighsInt buildKernelBlocks();
+  HighsInt buildKernelBtf(vector<HighsInt>& btf_block_start,
+                          vector<HighsInt>& btf_block_col,
+                          vector<HighsInt>& btf_block_row,
+                          vector<HighsInt>& btf_col_block);
+  void setKernelBlocks(const vector<HighsInt>& block_pivot_start,
+                       const vector<HighsInt>& block_start,
+                       const vector<HighsInt>& block_row);
+  bool kernelIsDense(const HighsInt num_active_col) const;
+  HighsInt buildKernelDense(const HighsInt num_active_col);
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
   void buildFinish();
   void zeroCol(const HighsInt iCol);
   void luClear();
+  bool useParallel() const;
   // Rebuild using refactor information
   HighsInt rebuild(HighsTimerClock* factor_timer_clock_pointer);
 
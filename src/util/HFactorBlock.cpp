@@ -0,0 +1,409 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorBlock.cpp
+ * @brief Decomposition of the kernel of the basis matrix into
+ * independent blocks and block triangular form
+ */
+#include <cassert>
+
+#include "parallel/HighsParallel.h"
+#include "util/HFactor.h"
+
+// std::max used in HFactor.h for local in-line functions, so HFactor.h
+// has #include <algorithm>
+using std::min;
+
+namespace {
+// A block of the kernel, formed as a matrix with local row and
+// column indices, and its factorization
+struct KernelBlock {
+  vector<HighsInt> col;
+  vector<HighsInt> row;
+  vector<HighsInt> a_start;
+  vector<HighsInt> a_index;
+  vector<double> a_value;
+  vector<HighsInt> basic_index;
+  HFactor factor;
+  HighsInt build_return = 0;
+};
+
+HighsInt findRoot(vector<HighsInt>& parent, HighsInt i) {
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+}  // namespace
+
+HighsInt HFactor::buildKernelBlocks() {
+  // If the kernel has connected components, their factorizations are
+  // independent. Group them into blocks, factor the blocks - in
+  // parallel if possible - and then store their factors as if they
+  // had been computed by buildKernel. The blocks don't depend on the
+  // number of threads, so neither does the factorization.
+  //
+  // The blocks are factored without handling rank deficiency or
+  // incomplete bases, so leave these cases to buildKernel
+  if (!kernel_blocks_ || num_basic != num_row ||
+      nwork < 2 * kBuildKernelBlockMinDim)
+    return kBuildKernelReturnNoBlocks;
+  const bool check_for_timeout = this->time_limit_ < kHighsInf;
+
+  // 1. Find the connected components of the kernel, using a
+  // union-find structure on the kernel columns, listed in iwork, by
+  // identifying the columns with entries in each row
+  vector<HighsInt> parent(num_basic);
+  for (HighsInt k = 0; k < nwork; k++) parent[iwork[k]] = iwork[k];
+  vector<HighsInt> row_col(num_row, -1);
+  for (HighsInt k = 0; k < nwork; k++) {
+    const HighsInt iCol = iwork[k];
+    const HighsInt start = mc_start[iCol];
+    const HighsInt end = start + mc_count_a[iCol];
+    for (HighsInt iEl = start; iEl < end; iEl++) {
+      const HighsInt iRow = mc_index[iEl];
+      if (row_col[iRow] < 0) {
+        row_col[iRow] = iCol;
+      } else {
+        const HighsInt root0 = findRoot(parent, row_col[iRow]);
+        const HighsInt root1 = findRoot(parent, iCol);
+        if (root0 != root1) parent[max(root0, root1)] = min(root0, root1);
+      }
+    }
+  }
+  // Number the components in order of their first column in iwork,
+  // and count their columns and rows
+  vector<HighsInt> component(num_basic, -1);
+  vector<HighsInt> component_num_col;
+  vector<HighsInt> component_num_row;
+  for (HighsInt k = 0; k < nwork; k++) {
+    const HighsInt iCol = iwork[k];
+    const HighsInt root = findRoot(parent, iCol);
+    if (component[root] < 0) {
+      component[root] = component_num_col.size();
+      component_num_col.push_back(0);
+      component_num_row.push_back(0);
+    }
+    component[iCol] = component[root];
+    component_num_col[component[iCol]]++;
+  }
+  const HighsInt num_component = component_num_col.size();
+  if (num_component < 2) return kBuildKernelReturnNoBlocks;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (row_col[iRow] >= 0) component_num_row[component[row_col[iRow]]]++;
+  // A component that's not square is structurally singular
+  for (HighsInt iC = 0; iC < num_component; iC++)
+    if (component_num_row[iC] != component_num_col[iC])
+      return kBuildKernelReturnNoBlocks;
+
+  // 2. Group the components into blocks of at least
+  // kBuildKernelBlockMinDim columns, adding any small remainder to
+  // the last block
+  vector<HighsInt> component_block(num_component);
+  HighsInt num_block = 0;
+  HighsInt block_dim = 0;
+  for (HighsInt iC = 0; iC < num_component; iC++) {
+    component_block[iC] = num_block;
+    block_dim += component_num_col[iC];
+    if (block_dim >= kBuildKernelBlockMinDim) {
+      num_block++;
+      block_dim = 0;
+    }
+  }
+  if (block_dim > 0) {
+    if (num_block == 0) return kBuildKernelReturnNoBlocks;
+    for (HighsInt iC = num_component - 1;
+         iC >= 0 && component_block[iC] == num_block; iC--)
+      component_block[iC] = num_block - 1;
+  }
+  if (num_block < 2) return kBuildKernelReturnNoBlocks;
+
+  // 3. Assign the columns and rows to the blocks, with local indices
+  // in order of the columns in iwork and the rows within them
+  vector<KernelBlock> block(num_block);
+  vector<HighsInt> local_index(num_row, -1);
+  for (HighsInt k = 0; k < nwork; k++) {
+    const HighsInt iCol = iwork[k];
+    KernelBlock& kernel_block = block[component_block[component[iCol]]];
+    kernel_block.col.push_back(iCol);
+    const HighsInt start = mc_start[iCol];
+    const HighsInt end = start + mc_count_a[iCol];
+    for (HighsInt iEl = start; iEl < end; iEl++) {
+      const HighsInt iRow = mc_index[iEl];
+      if (local_index[iRow] < 0) {
+        local_index[iRow] = kernel_block.row.size();
+        kernel_block.row.push_back(iRow);
+      }
+    }
+  }
+
+  // 4. Form and factor the blocks
+  const double time_limit =
+      check_for_timeout ? this->time_limit_ - build_timer_->readRunHighsClock()
+                        : kHighsInf;
+  auto factorBlocks = [&](HighsInt from_block, HighsInt to_block) {
+    for (HighsInt iB = from_block; iB < to_block; iB++) {
+      KernelBlock& kernel_block = block[iB];
+      const HighsInt dim = kernel_block.col.size();
+      kernel_block.a_start.push_back(0);
+      for (HighsInt iCol : kernel_block.col) {
+        const HighsInt start = mc_start[iCol];
+        const HighsInt end = start + mc_count_a[iCol];
+        for (HighsInt iEl = start; iEl < end; iEl++) {
+          kernel_block.a_index.push_back(local_index[mc_index[iEl]]);
+          kernel_block.a_value.push_back(mc_value[iEl]);
+        }
+        kernel_block.a_start.push_back(kernel_block.a_index.size());
+      }
+      kernel_block.basic_index.resize(dim);
+      for (HighsInt iCol = 0; iCol < dim; iCol++)
+        kernel_block.basic_index[iCol] = iCol;
+      HFactor& factor = kernel_block.factor;
+      factor.setupGeneral(dim, dim, dim, kernel_block.a_start.data(),
+                          kernel_block.a_index.data(),
+                          kernel_block.a_value.data(),
+                          kernel_block.basic_index.data(), pivot_threshold,
+                          pivot_tolerance, highs_debug_level, &log_options);
+      factor.kernel_blocks_ = false;
+      factor.setKernelDense(kernel_dense_min_dim_, kernel_dense_min_density_);
+      if (check_for_timeout) factor.setTimeLimit(time_limit);
+      kernel_block.build_return = factor.build();
+    }
+  };
+  if (useParallel()) {
+    highs::parallel::for_each(0, num_block, factorBlocks);
+  } else {
+    factorBlocks(0, num_block);
+  }
+  for (HighsInt iB = 0; iB < num_block; iB++) {
+    if (block[iB].build_return == kBuildKernelReturnTimeout)
+      return kBuildKernelReturnTimeout;
+    // Leave rank deficiency to buildKernel, since nothing has been
+    // stored yet
+    if (block[iB].build_return) return kBuildKernelReturnNoBlocks;
+  }
+
+  // 5. Store the factors of the blocks in L and U, pivot by pivot,
+  // as in buildKernel
+  vector<HighsInt> block_pivot_start;
+  vector<HighsInt> block_start;
+  vector<HighsInt> block_row;
+  for (HighsInt iB = 0; iB < num_block; iB++) {
+    block_pivot_start.push_back(l_start.size() - 1);
+    block_start.push_back(block_row.size());
+    block_row.insert(block_row.end(), block[iB].row.begin(),
+                     block[iB].row.end());
+    const KernelBlock& kernel_block = block[iB];
+    const HFactor& factor = kernel_block.factor;
+    const RefactorInfo& block_refactor_info = factor.refactor_info_;
+    const HighsInt dim = kernel_block.col.size();
+    for (HighsInt k = 0; k < dim; k++) {
+      const HighsInt local_row = block_refactor_info.pivot_row[k];
+      const HighsInt iRow = kernel_block.row[local_row];
+      const HighsInt iCol = kernel_block.col[block_refactor_info.pivot_var[k]];
+      assert(factor.u_pivot_index[k] == local_row);
+      permute[iCol] = iRow;
+      assert(mc_var[iCol] == basic_index[iCol]);
+
+      this->refactor_info_.pivot_row.push_back(iRow);
+      this->refactor_info_.pivot_var.push_back(basic_index[iCol]);
+      this->refactor_info_.pivot_type.push_back(kPivotMarkowitz);
+
+      // 5.1 Store the column of L
+      for (HighsInt iEl = factor.l_start[k]; iEl < factor.l_start[k + 1];
+           iEl++) {
+        l_index.push_back(kernel_block.row[factor.l_index[iEl]]);
+        l_value.push_back(factor.l_value[iEl]);
+      }
+      l_start.push_back(l_index.size());
+
+      // 5.2 Store the column of U: the entries in rows pivoted on
+      // before the kernel, then those in the block
+      const HighsInt end_N = mc_start[iCol] + mc_space[iCol];
+      const HighsInt start_N = end_N - mc_count_n[iCol];
+      for (HighsInt iEl = start_N; iEl < end_N; iEl++) {
+        u_index.push_back(mc_index[iEl]);
+        u_value.push_back(mc_value[iEl]);
+      }
+      for (HighsInt iEl = factor.u_start[k]; iEl < factor.u_last_p[k];
+           iEl++) {
+        u_index.push_back(kernel_block.row[factor.u_index[iEl]]);
+        u_value.push_back(factor.u_value[iEl]);
+      }
+      u_pivot_index.push_back(iRow);
+      u_pivot_value.push_back(factor.u_pivot_value[k]);
+      u_start.push_back(u_index.size());
+    }
+    build_synthetic_tick += factor.build_synthetic_tick;
+  }
+  block_start.push_back(block_row.size());
+  setKernelBlocks(block_pivot_start, block_start, block_row);
+  rank_deficiency = 0;
+  nwork = -1;
+  return rank_deficiency;
+}
+
+HighsInt HFactor::buildKernelBtf(vector<HighsInt>& btf_block_start,
+                                 vector<HighsInt>& btf_block_col,
+                                 vector<HighsInt>& btf_block_row,
+                                 vector<HighsInt>& btf_col_block) {
+  // Find the block triangular form of the kernel. The columns of
+  // block k have entries only in the rows of blocks 0..k, so the
+  // blocks can be factored in turn, and L is block diagonal. Returns
+  // the number of blocks, listing the columns and rows of each block
+  // from btf_block_start, and the block of each kernel column. Returns
+  // 0 if the kernel isn't square, or is structurally singular
+  btf_block_start.clear();
+  btf_block_col.clear();
+  btf_block_row.clear();
+  if (nwork < 2 || num_basic != num_row) return 0;
+  HighsInt num_kernel_row = 0;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (mr_count[iRow] > 0) num_kernel_row++;
+  if (num_kernel_row != nwork) return 0;
+
+  // 1. Find a maximum matching of the kernel columns and rows by
+  // depth-first search for augmenting paths, with a cheap assignment
+  // when a column has an unmatched row
+  vector<HighsInt> row_match(num_row, -1);
+  vector<HighsInt> col_match(num_basic, -1);
+  vector<HighsInt> row_visited(num_row, -1);
+  vector<HighsInt> cheap_next(num_basic);
+  for (HighsInt k = 0; k < nwork; k++) cheap_next[iwork[k]] = mc_start[iwork[k]];
+  vector<HighsInt> stack_col;
+  vector<HighsInt> stack_next;
+  double matching_work = 0;
+  for (HighsInt k = 0; k < nwork; k++) {
+    const HighsInt root_col = iwork[k];
+    stack_col.assign(1, root_col);
+    stack_next.assign(1, mc_start[root_col]);
+    HighsInt free_row = -1;
+    while (!stack_col.empty()) {
+      const HighsInt iCol = stack_col.back();
+      const HighsInt end = mc_start[iCol] + mc_count_a[iCol];
+      for (HighsInt& iEl = cheap_next[iCol]; iEl < end; iEl++) {
+        if (row_match[mc_index[iEl]] < 0) {
+          free_row = mc_index[iEl];
+          break;
+        }
+      }
+      if (free_row >= 0) break;
+      HighsInt& next = stack_next.back();
+      HighsInt child_col = -1;
+      for (; next < end; next++) {
+        matching_work++;
+        const HighsInt iRow = mc_index[next];
+        if (row_visited[iRow] == root_col) continue;
+        row_visited[iRow] = root_col;
+        child_col = row_match[iRow];
+        next++;
+        break;
+      }
+      if (child_col >= 0) {
+        stack_col.push_back(child_col);
+        stack_next.push_back(mc_start[child_col]);
+      } else {
+        stack_col.pop_back();
+        stack_next.pop_back();
+      }
+    }
+    // The kernel is structurally singular
+    if (free_row < 0) return 0;
+    // Augment the matching along the path: each column on it takes
+    // the row previously matched to the column above it
+    for (HighsInt iS = stack_col.size() - 1; iS >= 0; iS--) {
+      const HighsInt iCol = stack_col[iS];
+      const HighsInt previous_row = col_match[iCol];
+      col_match[iCol] = free_row;
+      row_match[free_row] = iCol;
+      free_row = previous_row;
+    }
+  }
+
+  // 2. Find the strongly connected components of the graph with an
+  // edge from each column to the columns matched to the other rows in
+  // which it has entries, using Tarjan's algorithm. The components
+  // are found with all the columns that they have edges to already
+  // found, which gives the block order
+  btf_col_block.assign(num_basic, -1);
+  vector<HighsInt> col_order(num_basic, -1);
+  vector<HighsInt> col_low(num_basic);
+  vector<HighsInt> component_stack;
+  HighsInt num_order = 0;
+  for (HighsInt k = 0; k < nwork; k++) {
+    const HighsInt root_col = iwork[k];
+    if (col_order[root_col] >= 0) continue;
+    col_order[root_col] = col_low[root_col] = num_order++;
+    component_stack.push_back(root_col);
+    stack_col.assign(1, root_col);
+    stack_next.assign(1, mc_start[root_col]);
+    while (!stack_col.empty()) {
+      const HighsInt iCol = stack_col.back();
+      HighsInt& next = stack_next.back();
+      if (next < mc_start[iCol] + mc_count_a[iCol]) {
+        const HighsInt to_col = row_match[mc_index[next++]];
+        if (to_col == iCol) continue;
+        if (col_order[to_col] < 0) {
+          col_order[to_col] = col_low[to_col] = num_order++;
+          component_stack.push_back(to_col);
+          stack_col.push_back(to_col);
+          stack_next.push_back(mc_start[to_col]);
+        } else if (btf_col_block[to_col] < 0) {
+          // to_col is on the component stack
+          col_low[iCol] = min(col_low[iCol], col_order[to_col]);
+        }
+        continue;
+      }
+      stack_col.pop_back();
+      stack_next.pop_back();
+      if (!stack_col.empty())
+        col_low[stack_col.back()] =
+            min(col_low[stack_col.back()], col_low[iCol]);
+      if (col_low[iCol] < col_order[iCol]) continue;
+      // iCol is the root of a component, so pop it off the component
+      // stack
+      const HighsInt block = btf_block_start.size();
+      btf_block_start.push_back(btf_block_col.size());
+      HighsInt component_col;
+      do {
+        component_col = component_stack.back();
+        component_stack.pop_back();
+        btf_col_block[component_col] = block;
+        btf_block_col.push_back(component_col);
+        btf_block_row.push_back(col_match[component_col]);
+      } while (component_col != iCol);
+    }
+  }
+  const HighsInt num_block = btf_block_start.size();
+  btf_block_start.push_back(btf_block_col.size());
+  build_synthetic_tick += matching_work * 10 + kernel_num_el * 20;
+  // Restricting the pivots to one block at a time gives more fill
+  // than unrestricted Markowitz pivoting when a block is most of the
+  // kernel, so only use the block triangular form if no block is too
+  // large
+  HighsInt max_block_dim = 0;
+  for (HighsInt iB = 0; iB < num_block; iB++)
+    max_block_dim =
+        max(btf_block_start[iB + 1] - btf_block_start[iB], max_block_dim);
+  if (max_block_dim > kBuildKernelBtfMaxBlockFraction * nwork) return 0;
+  return num_block;
+}
+
+void HFactor::setKernelBlocks(const vector<HighsInt>& block_pivot_start,
+                              const vector<HighsInt>& block_start,
+                              const vector<HighsInt>& block_row) {
+  // Record the blocks that the kernel has been factored as, given the
+  // pivot at which each block starts, and the rows of each block
+  const HighsInt num_block = block_pivot_start.size();
+  kernel_block_start = block_pivot_start;
+  kernel_block_start.push_back(l_start.size() - 1);
+  kernel_row_block.assign(num_row, -1);
+  for (HighsInt iB = 0; iB < num_block; iB++)
+    for (HighsInt k = block_start[iB]; k < block_start[iB + 1]; k++)
+      kernel_row_block[block_row[k]] = iB;
+}
@@ -0,0 +1,222 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorDense.cpp
+ * @brief Dense LU factorization of the kernel of the basis matrix
+ */
+#include <cassert>
+#include <cmath>
+
+#include "parallel/HighsParallel.h"
+#include "util/HFactor.h"
+
+// std::max and std::min used in HFactor.h for local in-line
+// functions, so HFactor.h has #include <algorithm>
+using std::fabs;
+using std::min;
+
+// The width of the panels of pivotal columns is chosen so that a
+// panel fits in kDensePanelBytes of cache when it's applied to the
+// trailing columns
+const HighsInt kDensePanelBytes = 256 * 1024;
+const HighsInt kDensePanelMinWidth = 8;
+const HighsInt kDensePanelMaxWidth = 64;
+// Minimum number of multiply-adds in the update of the trailing
+// columns for it to be performed in parallel
+const double kDenseParallelMinWork = 1e6;
+
+bool HFactor::kernelIsDense(const HighsInt num_active_col) const {
+  if (num_active_col < kernel_dense_min_dim_) return false;
+  // The kernel is dense if no active row or column has fewer than
+  // min_count entries. The search stops at the first nonempty count
+  // list, so is cheap unless the kernel is nearly dense
+  const HighsInt min_count =
+      (HighsInt)std::ceil(kernel_dense_min_density_ * num_active_col);
+  for (HighsInt count = 0; count < min_count; count++) {
+    if (count <= num_row && col_link_first[count] >= 0) return false;
+    if (count <= num_basic && row_link_first[count] >= 0) return false;
+  }
+  return true;
+}
+
+HighsInt HFactor::buildKernelDense(const HighsInt num_active_col) {
+  // Factor the active part of the kernel using right-looking dense
+  // LU with partial pivoting, processing the columns in panels
+  const bool check_for_timeout = this->time_limit_ < kHighsInf;
+
+  // 1. Gather the active columns and rows, and form the dense matrix
+  // column-wise
+  vector<HighsInt> dense_col;
+  for (HighsInt count = 0; count <= num_row; count++)
+    for (HighsInt j = col_link_first[count]; j != -1; j = col_link_next[j])
+      dense_col.push_back(j);
+  vector<HighsInt> dense_row;
+  vector<HighsInt> row_position(num_row, -1);
+  for (HighsInt count = 0; count <= num_basic; count++) {
+    for (HighsInt i = row_link_first[count]; i != -1; i = row_link_next[i]) {
+      row_position[i] = dense_row.size();
+      dense_row.push_back(i);
+    }
+  }
+  const HighsInt num_dense_col = dense_col.size();
+  const HighsInt num_dense_row = dense_row.size();
+  vector<double> dense((size_t)num_dense_row * num_dense_col, 0);
+  for (HighsInt jC = 0; jC < num_dense_col; jC++) {
+    const HighsInt iCol = dense_col[jC];
+    double* column = &dense[(size_t)jC * num_dense_row];
+    const HighsInt start = mc_start[iCol];
+    const HighsInt end = start + mc_count_a[iCol];
+    for (HighsInt k = start; k < end; k++) {
+      assert(row_position[mc_index[k]] >= 0);
+      column[row_position[mc_index[k]]] = mc_value[k];
+    }
+  }
+
+  // 2. Factor the dense matrix. Row interchanges are applied to all
+  // columns, so the pivot of the k-th pivotal column is in row k, and
+  // dense_row holds the kernel row of each dense row. Columns with no
+  // acceptable pivot are skipped, and yield the rank deficiency
+  const HighsInt panel_width =
+      max(kDensePanelMinWidth,
+          min(kDensePanelMaxWidth,
+              kDensePanelBytes / (HighsInt)(sizeof(double) *
+                                            max(num_dense_row, HighsInt{1}))));
+  const bool run_parallel = useParallel();
+  vector<HighsInt> pivot_col;
+  HighsInt num_pivot = 0;
+  double dense_work = 0;
+  for (HighsInt panel_start = 0; panel_start < num_dense_col;
+       panel_start += panel_width) {
+    if (check_for_timeout &&
+        build_timer_->readRunHighsClock() > this->time_limit_)
+      return kBuildKernelReturnTimeout;
+    const HighsInt panel_end = min(panel_start + panel_width, num_dense_col);
+    const HighsInt panel_pivot_start = num_pivot;
+    // 2.1 Factor the panel, updating its remaining columns after
+    // each pivot
+    for (HighsInt jC = panel_start; jC < panel_end; jC++) {
+      if (num_pivot == num_dense_row) break;
+      double* column = &dense[(size_t)jC * num_dense_row];
+      HighsInt pivot_k = -1;
+      double max_value = 0;
+      for (HighsInt k = num_pivot; k < num_dense_row; k++) {
+        if (fabs(column[k]) > max_value) {
+          max_value = fabs(column[k]);
+          pivot_k = k;
+        }
+      }
+      if (max_value < pivot_tolerance) continue;
+      if (pivot_k != num_pivot) {
+        for (HighsInt jSwap = 0; jSwap < num_dense_col; jSwap++) {
+          double* swap_column = &dense[(size_t)jSwap * num_dense_row];
+          std::swap(swap_column[pivot_k], swap_column[num_pivot]);
+        }
+        std::swap(dense_row[pivot_k], dense_row[num_pivot]);
+      }
+      const double pivot_value = column[num_pivot];
+      for (HighsInt k = num_pivot + 1; k < num_dense_row; k++)
+        column[k] /= pivot_value;
+      for (HighsInt jUpdate = jC + 1; jUpdate < panel_end; jUpdate++) {
+        double* update_column = &dense[(size_t)jUpdate * num_dense_row];
+        const double multiplier = update_column[num_pivot];
+        if (multiplier == 0) continue;
+        for (HighsInt k = num_pivot + 1; k < num_dense_row; k++)
+          update_column[k] -= multiplier * column[k];
+      }
+      dense_work +=
+          (double)(panel_end - jC) * (num_dense_row - num_pivot) + num_dense_col;
+      pivot_col.push_back(jC);
+      num_pivot++;
+    }
+    // 2.2 Apply the pivots of the panel to the trailing columns, in
+    // the same order as unblocked LU, so the panel is reused from
+    // cache for each trailing column
+    const HighsInt panel_num_pivot = num_pivot - panel_pivot_start;
+    if (panel_num_pivot == 0 || panel_end == num_dense_col) continue;
+    auto updateTrailingColumns = [&](HighsInt from_col, HighsInt to_col) {
+      for (HighsInt jC = from_col; jC < to_col; jC++) {
+        double* column = &dense[(size_t)jC * num_dense_row];
+        for (HighsInt k = panel_pivot_start; k < num_pivot; k++) {
+          const double multiplier = column[k];
+          if (multiplier == 0) continue;
+          const double* l_column =
+              &dense[(size_t)pivot_col[k] * num_dense_row];
+          for (HighsInt iK = k + 1; iK < num_dense_row; iK++)
+            column[iK] -= multiplier * l_column[iK];
+        }
+      }
+    };
+    const double trailing_work = (double)(num_dense_col - panel_end) *
+                                 panel_num_pivot *
+                                 (num_dense_row - panel_pivot_start);
+    dense_work += trailing_work;
+    if (run_parallel && trailing_work >= kDenseParallelMinWork) {
+      const HighsInt grain_size =
+          max(HighsInt{1}, (num_dense_col - panel_end) /
+                               (4 * highs::parallel::num_threads()));
+      highs::parallel::for_each(panel_end, num_dense_col,
+                                updateTrailingColumns, grain_size);
+    } else {
+      updateTrailingColumns(panel_end, num_dense_col);
+    }
+  }
+
+  // 3. Store the dense factors in L and U, pivot by pivot, as in
+  // buildKernel
+  for (HighsInt k = 0; k < num_pivot; k++) {
+    const HighsInt jC = pivot_col[k];
+    const HighsInt iCol = dense_col[jC];
+    const HighsInt iRow = dense_row[k];
+    const double* column = &dense[(size_t)jC * num_dense_row];
+    permute[iCol] = iRow;
+    assert(mc_var[iCol] == basic_index[iCol]);
+
+    this->refactor_info_.pivot_row.push_back(iRow);
+    this->refactor_info_.pivot_var.push_back(basic_index[iCol]);
+    this->refactor_info_.pivot_type.push_back(kPivotMarkowitz);
+
+    // 3.1 Store the column of L
+    for (HighsInt iK = k + 1; iK < num_dense_row; iK++) {
+      if (fabs(column[iK]) < kHighsTiny) continue;
+      l_index.push_back(dense_row[iK]);
+      l_value.push_back(column[iK]);
+    }
+    l_start.push_back(l_index.size());
+
+    // 3.2 Store the column of U: the entries in rows pivoted on
+    // before forming the dense matrix, then those in the rows of
+    // previous dense pivots
+    const HighsInt end_N = mc_start[iCol] + mc_space[iCol];
+    const HighsInt start_N = end_N - mc_count_n[iCol];
+    for (HighsInt iEl = start_N; iEl < end_N; iEl++) {
+      u_index.push_back(mc_index[iEl]);
+      u_value.push_back(mc_value[iEl]);
+    }
+    for (HighsInt iK = 0; iK < k; iK++) {
+      if (fabs(column[iK]) < kHighsTiny) continue;
+      u_index.push_back(dense_row[iK]);
+      u_value.push_back(column[iK]);
+    }
+    u_pivot_index.push_back(iRow);
+    u_pivot_value.push_back(column[k]);
+    u_start.push_back(u_index.size());
+  }
+  // Dense elimination is much cheaper per entry than sparse
+  // elimination
+  build_synthetic_tick +=
+      (double)num_dense_row * num_dense_col * 20 + dense_work * 10;
+
+  // Columns that have been zeroed, or have no acceptable pivot in the
+  // dense matrix, yield the rank deficiency
+  rank_deficiency = num_active_col - num_pivot;
+  nwork = rank_deficiency - 1;
+  if (rank_deficiency)
+    highsLogDev(log_options, HighsLogType::kWarning,
+                "Factorization identifies rank deficiency of %d\n",
+                (int)rank_deficiency);
+  return rank_deficiency;
+}
@@ -223,6 +223,11 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   for (HighsInt iRow = ur_cur_num_vec; iRow < ur_new_num_vec; iRow++)
     ur_lastp[iRow] = ur_start[iRow];
   //
+  // The new rows of L aren't in the kernel blocks, so L is no longer
+  // block diagonal within the kernel
+  kernel_block_start.clear();
+  kernel_row_block.clear();
+  //
   // Increase the number of rows in HFactor
   num_row += num_new_row;
   //  reportLu(kReportLuBoth, true);
@@ -17,6 +17,61 @@
 #include "lp_data/HConst.h"
 #include "stdio.h"  //Just for temporary printf
 #include "util/HighsCDouble.h"
+#include "util/HighsSimd.h"
+
+// Generic versions of the (possibly vectorised) kernels in
+// HighsSimd.h, which are used when the HVector values aren't double
+
+template <typename Real>
+static void zeroTiny(Real* array, const HighsInt count) {
+  using std::abs;
+  for (HighsInt i = 0; i < count; i++)
+    if (abs(array[i]) < kHighsTiny) array[i] = 0;
+}
+
+template <typename Real>
+static HighsInt tightIndexed(Real* array, HighsInt* index,
+                             const HighsInt count) {
+  using std::abs;
+  HighsInt new_count = 0;
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt my_index = index[k];
+    const Real& value = array[my_index];
+    if (abs(value) >= kHighsTiny) {
+      index[new_count++] = my_index;
+    } else {
+      array[my_index] = Real{0};
+    }
+  }
+  return new_count;
+}
+
+template <typename Real>
+static Real sumSquares(const Real* array, const HighsInt* index,
+                       const HighsInt count) {
+  Real result = Real{0};
+  for (HighsInt k = 0; k < count; k++) {
+    Real value = array[index[k]];
+    result += value * value;
+  }
+  return result;
+}
+
+template <typename Real, typename RealPivX, typename RealPiv>
+static void addMultipleTrack(Real* array, HighsInt* array_index,
+                             HighsInt& array_count, const RealPivX multiplier,
+                             const RealPiv* from_array,
+                             const HighsInt* from_index,
+                             const HighsInt count) {
+  using std::abs;
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iRow = from_index[k];
+    const Real x0 = array[iRow];
+    const Real x1 = Real(x0 + multiplier * from_array[iRow]);
+    if (x0 == Real{0}) array_index[array_count++] = iRow;
+    array[iRow] = (abs(x1) < kHighsTiny) ? kHighsZero : x1;
+  }
+}
 
 template <typename Real>
 void HVectorBase<Real>::setup(HighsInt size_) {
@@ -84,22 +139,10 @@ void HVectorBase<Real>::tight() {
    * Zero values in Vector.array that do not exceed kHighsTiny in
    * magnitude, maintaining index if it is well defined
    */
-  HighsInt totalCount = 0;
-  using std::abs;
   if (count < 0) {
-    for (size_t my_index = 0; my_index < array.size(); my_index++)
-      if (abs(array[my_index]) < kHighsTiny) array[my_index] = 0;
+    zeroTiny(array.data(), (HighsInt)array.size());
   } else {
-    for (HighsInt i = 0; i < count; i++) {
-      const HighsInt my_index = index[i];
-      const Real& value = array[my_index];
-      if (abs(value) >= kHighsTiny) {
-        index[totalCount++] = my_index;
-      } else {
-        array[my_index] = Real{0};
-      }
-    }
-    count = totalCount;
+    count = tightIndexed(array.data(), index.data(), count);
   }
 }
 
@@ -158,16 +201,7 @@ Real HVectorBase<Real>::norm2() const {
   /*
    * Compute the squared 2-norm of the vector
    */
-  const HighsInt workCount = count;
-  const HighsInt* workIndex = &index[0];
-  const Real* workArray = &array[0];
-
-  Real result = Real{0};
-  for (HighsInt i = 0; i < workCount; i++) {
-    Real value = workArray[workIndex[i]];
-    result += value * value;
-  }
-  return result;
+  return sumSquares(array.data(), index.data(), count);
 }
 
 template <typename Real>
@@ -180,23 +214,8 @@ void HVectorBase<Real>::saxpy(const RealPivX pivotX,
    * The real types may all be different but must mix in operations and be
    * convertible to this HVector's real type.
    */
-  HighsInt workCount = count;
-  HighsInt* workIndex = &index[0];
-  Real* workArray = &array[0];
-
-  const HighsInt pivotCount = pivot->count;
-  const HighsInt* pivotIndex = &pivot->index[0];
-  const RealPiv* pivotArray = &pivot->array[0];
-
-  using std::abs;
-  for (HighsInt k = 0; k < pivotCount; k++) {
-    const HighsInt iRow = pivotIndex[k];
-    const Real x0 = workArray[iRow];
-    const Real x1 = Real(x0 + pivotX * pivotArray[iRow]);
-    if (x0 == Real{0}) workIndex[workCount++] = iRow;
-    workArray[iRow] = (abs(x1) < kHighsTiny) ? kHighsZero : x1;
-  }
-  count = workCount;
+  addMultipleTrack(array.data(), index.data(), count, pivotX,
+                   pivot->array.data(), pivot->index.data(), pivot->count);
 }
 
 template <typename Real>
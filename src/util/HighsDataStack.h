@@ -46,6 +46,13 @@ class HighsDataStack {
     std::memcpy(&r, data.data() + position, sizeof(T));
   }
 
+  // overwrite the value that was popped last, leaving the position unchanged
+  template <typename T,
+            typename std::enable_if<IS_TRIVIALLY_COPYABLE(T), int>::type = 0>
+  void overwrite(const T& r) {
+    std::memcpy(data.data() + position, &r, sizeof(T));
+  }
+
   template <typename T>
   void push(const std::vector<T>& r) {
     std::size_t offset = data.size();
@@ -1426,7 +1426,8 @@ class HighsHashTree {
     other.root = nullptr;
   }
 
-  HighsHashTree(const HighsHashTree& other) : root(copy_recurse(other.root)) {}
+  HighsHashTree(const HighsHashTree& other)
+      : root(other.empty() ? NodePtr() : copy_recurse(other.root)) {}
 
   HighsHashTree& operator=(HighsHashTree&& other) {
     destroy_recurse(root);
@@ -1437,7 +1438,7 @@ class HighsHashTree {
 
   HighsHashTree& operator=(const HighsHashTree& other) {
     destroy_recurse(root);
-    root = copy_recurse(other.root);
+    root = other.empty() ? NodePtr() : copy_recurse(other.root);
     return *this;
   }
 
@@ -0,0 +1,547 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.cpp
+ * @brief
+ */
+#include "util/HighsSimd.h"
+
+#include <cassert>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HIGHS_SIMD_X86
+#include <immintrin.h>
+#define HIGHS_TARGET_AVX2 __attribute__((target("avx2")))
+#define HIGHS_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+HighsSimdLevel highsSimdMaxLevel() {
+#ifdef HIGHS_SIMD_X86
+  // Called when initialising highs_simd_level, so the CPU model may
+  // not have been initialised
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return HighsSimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2")) return HighsSimdLevel::kAvx2;
+#endif
+  return HighsSimdLevel::kScalar;
+}
+
+HighsSimdLevel highs_simd_level = highsSimdMaxLevel();
+
+HighsSimdLevel highsSimdSetLevel(const HighsSimdLevel level) {
+  const HighsSimdLevel max_level = highsSimdMaxLevel();
+  highs_simd_level = level < max_level ? level : max_level;
+  return highs_simd_level;
+}
+
+std::string highsSimdLevelToString(const HighsSimdLevel level) {
+  switch (level) {
+    case HighsSimdLevel::kAvx512:
+      return "AVX-512";
+    case HighsSimdLevel::kAvx2:
+      return "AVX2";
+    default:
+      return "scalar";
+  }
+}
+
+#ifdef HIGHS_SIMD_X86
+namespace {
+
+const HighsInt kAvx2Width = 4;
+const HighsInt kAvx512Width = 8;
+
+// Gather array[index[0..3]]
+HIGHS_TARGET_AVX2 inline __m256d avx2Gather(const double* array,
+                                            const HighsInt* index) {
+#ifdef HIGHSINT64
+  const __m256i vindex =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index));
+  return _mm256_i64gather_pd(array, vindex, 8);
+#else
+  const __m128i vindex =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(index));
+  return _mm256_i32gather_pd(array, vindex, 8);
+#endif
+}
+
+// Form products that the compiler can't fuse with a subsequent
+// addition or subtraction into an FMA (as GCC does for the AVX-512
+// target) unless scalar arithmetic is also compiled with FMA, so that
+// the vectorised and scalar results are identical
+HIGHS_TARGET_AVX2 inline __m256d avx2Mul(const __m256d x, const __m256d y) {
+  __m256d product = _mm256_mul_pd(x, y);
+#ifndef __FMA__
+  __asm__("" : "+x"(product));
+#endif
+  return product;
+}
+
+HIGHS_TARGET_AVX2 inline __m256d avx2Abs(const __m256d x) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+
+// Gather array[index[0..7]] and scatter to array[index[0..7]]
+#ifdef HIGHSINT64
+HIGHS_TARGET_AVX512 inline __m512i avx512LoadIndex(const HighsInt* index) {
+  return _mm512_loadu_si512(index);
+}
+HIGHS_TARGET_AVX512 inline __m512d avx512Gather(const double* array,
+                                                const __m512i vindex) {
+  return _mm512_i64gather_pd(vindex, array, 8);
+}
+HIGHS_TARGET_AVX512 inline void avx512Scatter(double* array,
+                                              const __m512i vindex,
+                                              const __m512d x) {
+  _mm512_i64scatter_pd(array, vindex, x, 8);
+}
+#else
+HIGHS_TARGET_AVX512 inline __m256i avx512LoadIndex(const HighsInt* index) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index));
+}
+HIGHS_TARGET_AVX512 inline __m512d avx512Gather(const double* array,
+                                                const __m256i vindex) {
+  return _mm512_i32gather_pd(vindex, array, 8);
+}
+HIGHS_TARGET_AVX512 inline void avx512Scatter(double* array,
+                                              const __m256i vindex,
+                                              const __m512d x) {
+  _mm512_i32scatter_pd(array, vindex, x, 8);
+}
+#endif
+
+HIGHS_TARGET_AVX512 inline __m512d avx512Mul(const __m512d x,
+                                             const __m512d y) {
+  __m512d product = _mm512_mul_pd(x, y);
+#ifndef __FMA__
+  __asm__("" : "+v"(product));
+#endif
+  return product;
+}
+
+HIGHS_TARGET_AVX512 inline __m512d avx512Abs(const __m512d x) {
+  return _mm512_castsi512_pd(_mm512_and_si512(
+      _mm512_castpd_si512(x), _mm512_set1_epi64(0x7fffffffffffffffLL)));
+}
+
+HIGHS_TARGET_AVX2 HighsInt avx2SubtractMultiple(double* array,
+                                                const double multiplier,
+                                                const HighsInt* index,
+                                                const double* value,
+                                                const HighsInt count) {
+  const __m256d vmultiplier = _mm256_set1_pd(multiplier);
+  alignas(32) double result[kAvx2Width];
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x = avx2Gather(array, &index[k]);
+    const __m256d v = _mm256_loadu_pd(&value[k]);
+    _mm256_store_pd(result, _mm256_sub_pd(x, avx2Mul(vmultiplier, v)));
+    // AVX2 has no scatter
+    for (HighsInt i = 0; i < kAvx2Width; i++) array[index[k + i]] = result[i];
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512SubtractMultiple(double* array,
+                                                    const double multiplier,
+                                                    const HighsInt* index,
+                                                    const double* value,
+                                                    const HighsInt count) {
+  const __m512d vmultiplier = _mm512_set1_pd(multiplier);
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const auto vindex = avx512LoadIndex(&index[k]);
+    const __m512d x = avx512Gather(array, vindex);
+    const __m512d v = _mm512_loadu_pd(&value[k]);
+    avx512Scatter(array, vindex,
+                  _mm512_sub_pd(x, avx512Mul(vmultiplier, v)));
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX2 HighsInt avx2SubtractMultipleTrack(
+    double* array, HighsInt* array_index, HighsInt& array_count,
+    const double multiplier, const HighsInt* index, const double* value,
+    const HighsInt count) {
+  const __m256d vmultiplier = _mm256_set1_pd(multiplier);
+  const __m256d vzero = _mm256_setzero_pd();
+  const __m256d vtiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d vhighs_zero = _mm256_set1_pd(kHighsZero);
+  alignas(32) double result[kAvx2Width];
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x0 = avx2Gather(array, &index[k]);
+    const __m256d v = _mm256_loadu_pd(&value[k]);
+    __m256d x1 = _mm256_sub_pd(x0, avx2Mul(vmultiplier, v));
+    x1 = _mm256_blendv_pd(x1, vhighs_zero,
+                          _mm256_cmp_pd(avx2Abs(x1), vtiny, _CMP_LT_OQ));
+    _mm256_store_pd(result, x1);
+    const int new_nonzero =
+        _mm256_movemask_pd(_mm256_cmp_pd(x0, vzero, _CMP_EQ_OQ));
+    for (HighsInt i = 0; i < kAvx2Width; i++) {
+      const HighsInt iRow = index[k + i];
+      if (new_nonzero & (1 << i)) array_index[array_count++] = iRow;
+      array[iRow] = result[i];
+    }
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512SubtractMultipleTrack(
+    double* array, HighsInt* array_index, HighsInt& array_count,
+    const double multiplier, const HighsInt* index, const double* value,
+    const HighsInt count) {
+  const __m512d vmultiplier = _mm512_set1_pd(multiplier);
+  const __m512d vzero = _mm512_setzero_pd();
+  const __m512d vtiny = _mm512_set1_pd(kHighsTiny);
+  const __m512d vhighs_zero = _mm512_set1_pd(kHighsZero);
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const auto vindex = avx512LoadIndex(&index[k]);
+    const __m512d x0 = avx512Gather(array, vindex);
+    const __m512d v = _mm512_loadu_pd(&value[k]);
+    __m512d x1 = _mm512_sub_pd(x0, avx512Mul(vmultiplier, v));
+    x1 = _mm512_mask_blend_pd(
+        _mm512_cmp_pd_mask(avx512Abs(x1), vtiny, _CMP_LT_OQ), x1,
+        vhighs_zero);
+    avx512Scatter(array, vindex, x1);
+    const __mmask8 new_nonzero = _mm512_cmp_pd_mask(x0, vzero, _CMP_EQ_OQ);
+    if (new_nonzero) {
+      for (HighsInt i = 0; i < kAvx512Width; i++)
+        if (new_nonzero & (1 << i)) array_index[array_count++] = index[k + i];
+    }
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX2 HighsInt avx2AddMultipleTrack(
+    double* array, HighsInt* array_index, HighsInt& array_count,
+    const double multiplier, const double* from_array,
+    const HighsInt* from_index, const HighsInt count) {
+  const __m256d vmultiplier = _mm256_set1_pd(multiplier);
+  const __m256d vzero = _mm256_setzero_pd();
+  const __m256d vtiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d vhighs_zero = _mm256_set1_pd(kHighsZero);
+  alignas(32) double result[kAvx2Width];
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x0 = avx2Gather(array, &from_index[k]);
+    const __m256d v = avx2Gather(from_array, &from_index[k]);
+    __m256d x1 = _mm256_add_pd(x0, avx2Mul(vmultiplier, v));
+    x1 = _mm256_blendv_pd(x1, vhighs_zero,
+                          _mm256_cmp_pd(avx2Abs(x1), vtiny, _CMP_LT_OQ));
+    _mm256_store_pd(result, x1);
+    const int new_nonzero =
+        _mm256_movemask_pd(_mm256_cmp_pd(x0, vzero, _CMP_EQ_OQ));
+    for (HighsInt i = 0; i < kAvx2Width; i++) {
+      const HighsInt iRow = from_index[k + i];
+      if (new_nonzero & (1 << i)) array_index[array_count++] = iRow;
+      array[iRow] = result[i];
+    }
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512AddMultipleTrack(
+    double* array, HighsInt* array_index, HighsInt& array_count,
+    const double multiplier, const double* from_array,
+    const HighsInt* from_index, const HighsInt count) {
+  const __m512d vmultiplier = _mm512_set1_pd(multiplier);
+  const __m512d vzero = _mm512_setzero_pd();
+  const __m512d vtiny = _mm512_set1_pd(kHighsTiny);
+  const __m512d vhighs_zero = _mm512_set1_pd(kHighsZero);
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const auto vindex = avx512LoadIndex(&from_index[k]);
+    const __m512d x0 = avx512Gather(array, vindex);
+    const __m512d v = avx512Gather(from_array, vindex);
+    __m512d x1 = _mm512_add_pd(x0, avx512Mul(vmultiplier, v));
+    x1 = _mm512_mask_blend_pd(
+        _mm512_cmp_pd_mask(avx512Abs(x1), vtiny, _CMP_LT_OQ), x1,
+        vhighs_zero);
+    avx512Scatter(array, vindex, x1);
+    const __mmask8 new_nonzero = _mm512_cmp_pd_mask(x0, vzero, _CMP_EQ_OQ);
+    if (new_nonzero) {
+      for (HighsInt i = 0; i < kAvx512Width; i++)
+        if (new_nonzero & (1 << i))
+          array_index[array_count++] = from_index[k + i];
+    }
+  }
+  return k;
+}
+
+// The products are formed in parallel, but are subtracted in order
+HIGHS_TARGET_AVX2 HighsInt avx2SubtractDot(double& result, const double* array,
+                                           const HighsInt* index,
+                                           const double* value,
+                                           const HighsInt count) {
+  alignas(32) double product[kAvx2Width];
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x = avx2Gather(array, &index[k]);
+    const __m256d v = _mm256_loadu_pd(&value[k]);
+    _mm256_store_pd(product, avx2Mul(x, v));
+    for (HighsInt i = 0; i < kAvx2Width; i++) result -= product[i];
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512SubtractDot(double& result,
+                                               const double* array,
+                                               const HighsInt* index,
+                                               const double* value,
+                                               const HighsInt count) {
+  alignas(64) double product[kAvx512Width];
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const __m512d x = avx512Gather(array, avx512LoadIndex(&index[k]));
+    const __m512d v = _mm512_loadu_pd(&value[k]);
+    _mm512_store_pd(product, avx512Mul(x, v));
+    for (HighsInt i = 0; i < kAvx512Width; i++) result -= product[i];
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX2 HighsInt avx2SumSquares(double& result, const double* array,
+                                          const HighsInt* index,
+                                          const HighsInt count) {
+  alignas(32) double product[kAvx2Width];
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x = avx2Gather(array, &index[k]);
+    _mm256_store_pd(product, avx2Mul(x, x));
+    for (HighsInt i = 0; i < kAvx2Width; i++) result += product[i];
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512SumSquares(double& result,
+                                              const double* array,
+                                              const HighsInt* index,
+                                              const HighsInt count) {
+  alignas(64) double product[kAvx512Width];
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const __m512d x = avx512Gather(array, avx512LoadIndex(&index[k]));
+    _mm512_store_pd(product, avx512Mul(x, x));
+    for (HighsInt i = 0; i < kAvx512Width; i++) result += product[i];
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX2 HighsInt avx2ZeroTiny(double* array, const HighsInt count) {
+  const __m256d vzero = _mm256_setzero_pd();
+  const __m256d vtiny = _mm256_set1_pd(kHighsTiny);
+  HighsInt i = 0;
+  for (; i + kAvx2Width <= count; i += kAvx2Width) {
+    const __m256d x = _mm256_loadu_pd(&array[i]);
+    _mm256_storeu_pd(
+        &array[i],
+        _mm256_blendv_pd(x, vzero,
+                         _mm256_cmp_pd(avx2Abs(x), vtiny, _CMP_LT_OQ)));
+  }
+  return i;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512ZeroTiny(double* array,
+                                            const HighsInt count) {
+  const __m512d vzero = _mm512_setzero_pd();
+  const __m512d vtiny = _mm512_set1_pd(kHighsTiny);
+  HighsInt i = 0;
+  for (; i + kAvx512Width <= count; i += kAvx512Width) {
+    const __m512d x = _mm512_loadu_pd(&array[i]);
+    _mm512_storeu_pd(
+        &array[i],
+        _mm512_mask_blend_pd(
+            _mm512_cmp_pd_mask(avx512Abs(x), vtiny, _CMP_LT_OQ), x, vzero));
+  }
+  return i;
+}
+
+// Since new_count <= k, the indices are compacted in place safely
+HIGHS_TARGET_AVX2 HighsInt avx2Tight(double* array, HighsInt* index,
+                                     HighsInt& new_count,
+                                     const HighsInt count) {
+  const __m256d vtiny = _mm256_set1_pd(kHighsTiny);
+  HighsInt k = 0;
+  for (; k + kAvx2Width <= count; k += kAvx2Width) {
+    const __m256d x = avx2Gather(array, &index[k]);
+    const int keep =
+        _mm256_movemask_pd(_mm256_cmp_pd(avx2Abs(x), vtiny, _CMP_GE_OQ));
+    for (HighsInt i = 0; i < kAvx2Width; i++) {
+      const HighsInt iRow = index[k + i];
+      if (keep & (1 << i)) {
+        index[new_count++] = iRow;
+      } else {
+        array[iRow] = 0;
+      }
+    }
+  }
+  return k;
+}
+
+HIGHS_TARGET_AVX512 HighsInt avx512Tight(double* array, HighsInt* index,
+                                         HighsInt& new_count,
+                                         const HighsInt count) {
+  const __m512d vtiny = _mm512_set1_pd(kHighsTiny);
+  HighsInt k = 0;
+  for (; k + kAvx512Width <= count; k += kAvx512Width) {
+    const __m512d x = avx512Gather(array, avx512LoadIndex(&index[k]));
+    const __mmask8 keep =
+        _mm512_cmp_pd_mask(avx512Abs(x), vtiny, _CMP_GE_OQ);
+    for (HighsInt i = 0; i < kAvx512Width; i++) {
+      const HighsInt iRow = index[k + i];
+      if (keep & (1 << i)) {
+        index[new_count++] = iRow;
+      } else {
+        array[iRow] = 0;
+      }
+    }
+  }
+  return k;
+}
+
+}  // namespace
+#endif
+
+// Each of the following kernels performs its vectorised loop, if
+// there is one for the level, and then completes the loop in scalar
+// arithmetic
+
+void highsSimdSubtractMultiple(const HighsSimdLevel level, double* array,
+                               const double multiplier, const HighsInt* index,
+                               const double* value, const HighsInt count) {
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512SubtractMultiple(array, multiplier, index, value, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2SubtractMultiple(array, multiplier, index, value, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++)
+    array[index[k]] -= multiplier * value[k];
+}
+
+void highsSimdSubtractMultipleTrack(const HighsSimdLevel level, double* array,
+                                    HighsInt* array_index,
+                                    HighsInt& array_count,
+                                    const double multiplier,
+                                    const HighsInt* index, const double* value,
+                                    const HighsInt count) {
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512SubtractMultipleTrack(array, array_index, array_count,
+                                         multiplier, index, value, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2SubtractMultipleTrack(array, array_index, array_count,
+                                       multiplier, index, value, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++) {
+    const HighsInt iRow = index[k];
+    const double value0 = array[iRow];
+    const double value1 = value0 - multiplier * value[k];
+    if (value0 == 0) array_index[array_count++] = iRow;
+    array[iRow] = (std::fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+void highsSimdAddMultipleTrack(const HighsSimdLevel level, double* array,
+                               HighsInt* array_index, HighsInt& array_count,
+                               const double multiplier,
+                               const double* from_array,
+                               const HighsInt* from_index,
+                               const HighsInt count) {
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512AddMultipleTrack(array, array_index, array_count,
+                                    multiplier, from_array, from_index, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2AddMultipleTrack(array, array_index, array_count, multiplier,
+                                  from_array, from_index, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++) {
+    const HighsInt iRow = from_index[k];
+    const double x0 = array[iRow];
+    const double x1 = x0 + multiplier * from_array[iRow];
+    if (x0 == 0) array_index[array_count++] = iRow;
+    array[iRow] = (std::fabs(x1) < kHighsTiny) ? kHighsZero : x1;
+  }
+}
+
+double highsSimdSubtractDot(const HighsSimdLevel level, double result,
+                            const double* array, const HighsInt* index,
+                            const double* value, const HighsInt count) {
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512SubtractDot(result, array, index, value, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2SubtractDot(result, array, index, value, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++) result -= array[index[k]] * value[k];
+  return result;
+}
+
+double highsSimdSumSquares(const HighsSimdLevel level, const double* array,
+                           const HighsInt* index, const HighsInt count) {
+  double result = 0;
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512SumSquares(result, array, index, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2SumSquares(result, array, index, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++) {
+    const double value = array[index[k]];
+    result += value * value;
+  }
+  return result;
+}
+
+void highsSimdZeroTiny(const HighsSimdLevel level, double* array,
+                       const HighsInt count) {
+  HighsInt from_i = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_i = avx512ZeroTiny(array, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_i = avx2ZeroTiny(array, count);
+  }
+#endif
+  for (HighsInt i = from_i; i < count; i++)
+    if (std::fabs(array[i]) < kHighsTiny) array[i] = 0;
+}
+
+HighsInt highsSimdTight(const HighsSimdLevel level, double* array,
+                        HighsInt* index, const HighsInt count) {
+  HighsInt new_count = 0;
+  HighsInt from_k = 0;
+#ifdef HIGHS_SIMD_X86
+  if (level == HighsSimdLevel::kAvx512) {
+    from_k = avx512Tight(array, index, new_count, count);
+  } else if (level == HighsSimdLevel::kAvx2) {
+    from_k = avx2Tight(array, index, new_count, count);
+  }
+#endif
+  for (HighsInt k = from_k; k < count; k++) {
+    const HighsInt iRow = index[k];
+    if (std::fabs(array[iRow]) >= kHighsTiny) {
+      index[new_count++] = iRow;
+    } else {
+      array[iRow] = 0;
+    }
+  }
+  return new_count;
+}
@@ -0,0 +1,185 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.h
+ * @brief Vectorised kernels for the indexed loops in HFactor and
+ * HVector, with runtime dispatch to AVX2 or AVX-512 and a scalar
+ * fallback
+ *
+ * The vectorised kernels only use FMA if the scalar code is compiled
+ * with it, and accumulate in the same order as the scalar kernels, so
+ * the results are identical whatever the instruction set used. Each
+ * kernel assumes that the indices passed to it are distinct.
+ */
+#ifndef UTIL_HIGHSSIMD_H_
+#define UTIL_HIGHSSIMD_H_
+
+#include <cmath>
+#include <string>
+
+#include "lp_data/HConst.h"
+#include "util/HighsInt.h"
+
+enum class HighsSimdLevel { kScalar = 0, kAvx2, kAvx512 };
+
+// The vectorised kernels are only worth calling for loops of at least
+// this length
+const HighsInt kHighsSimdMinCount = 16;
+
+extern HighsSimdLevel highs_simd_level;
+
+// Highest instruction set supported by both the build and the CPU
+HighsSimdLevel highsSimdMaxLevel();
+// Set the instruction set used, limited by highsSimdMaxLevel(), returning
+// the level that's actually used. Only for testing and benchmarking,
+// since it's not thread safe
+HighsSimdLevel highsSimdSetLevel(const HighsSimdLevel level);
+std::string highsSimdLevelToString(const HighsSimdLevel level);
+
+void highsSimdSubtractMultiple(const HighsSimdLevel level, double* array,
+                               const double multiplier, const HighsInt* index,
+                               const double* value, const HighsInt count);
+void highsSimdSubtractMultipleTrack(const HighsSimdLevel level, double* array,
+                                    HighsInt* array_index,
+                                    HighsInt& array_count,
+                                    const double multiplier,
+                                    const HighsInt* index, const double* value,
+                                    const HighsInt count);
+void highsSimdAddMultipleTrack(const HighsSimdLevel level, double* array,
+                               HighsInt* array_index, HighsInt& array_count,
+                               const double multiplier,
+                               const double* from_array,
+                               const HighsInt* from_index,
+                               const HighsInt count);
+double highsSimdSubtractDot(const HighsSimdLevel level, double result,
+                            const double* array, const HighsInt* index,
+                            const double* value, const HighsInt count);
+double highsSimdSumSquares(const HighsSimdLevel level, const double* array,
+                           const HighsInt* index, const HighsInt count);
+void highsSimdZeroTiny(const HighsSimdLevel level, double* array,
+                       const HighsInt count);
+HighsInt highsSimdTight(const HighsSimdLevel level, double* array,
+                        HighsInt* index, const HighsInt count);
+
+// array[index[k]] -= multiplier * value[k]
+inline void subtractMultiple(double* array, const double multiplier,
+                             const HighsInt* index, const double* value,
+                             const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar) {
+    highsSimdSubtractMultiple(highs_simd_level, array, multiplier, index,
+                              value, count);
+    return;
+  }
+  for (HighsInt k = 0; k < count; k++)
+    array[index[k]] -= multiplier * value[k];
+}
+
+// array[index[k]] -= multiplier * value[k], adding index[k] to
+// array_index if array[index[k]] was zero, and replacing tiny results
+// by kHighsZero
+inline void subtractMultipleTrack(double* array, HighsInt* array_index,
+                                  HighsInt& array_count,
+                                  const double multiplier,
+                                  const HighsInt* index, const double* value,
+                                  const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar) {
+    highsSimdSubtractMultipleTrack(highs_simd_level, array, array_index,
+                                   array_count, multiplier, index, value,
+                                   count);
+    return;
+  }
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iRow = index[k];
+    const double value0 = array[iRow];
+    const double value1 = value0 - multiplier * value[k];
+    if (value0 == 0) array_index[array_count++] = iRow;
+    array[iRow] = (std::fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+// array[from_index[k]] += multiplier * from_array[from_index[k]], with
+// the same tracking as subtractMultipleTrack
+inline void addMultipleTrack(double* array, HighsInt* array_index,
+                             HighsInt& array_count, const double multiplier,
+                             const double* from_array,
+                             const HighsInt* from_index,
+                             const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar) {
+    highsSimdAddMultipleTrack(highs_simd_level, array, array_index,
+                              array_count, multiplier, from_array, from_index,
+                              count);
+    return;
+  }
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iRow = from_index[k];
+    const double x0 = array[iRow];
+    const double x1 = x0 + multiplier * from_array[iRow];
+    if (x0 == 0) array_index[array_count++] = iRow;
+    array[iRow] = (std::fabs(x1) < kHighsTiny) ? kHighsZero : x1;
+  }
+}
+
+// result - sum_k array[index[k]] * value[k], subtracting in order of k
+inline double subtractDot(double result, const double* array,
+                          const HighsInt* index, const double* value,
+                          const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar)
+    return highsSimdSubtractDot(highs_simd_level, result, array, index, value,
+                                count);
+  for (HighsInt k = 0; k < count; k++) result -= array[index[k]] * value[k];
+  return result;
+}
+
+// sum_k array[index[k]]^2, summing in order of k
+inline double sumSquares(const double* array, const HighsInt* index,
+                         const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar)
+    return highsSimdSumSquares(highs_simd_level, array, index, count);
+  double result = 0;
+  for (HighsInt k = 0; k < count; k++) {
+    const double value = array[index[k]];
+    result += value * value;
+  }
+  return result;
+}
+
+// Zero the values in array that are less than kHighsTiny in magnitude
+inline void zeroTiny(double* array, const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar) {
+    highsSimdZeroTiny(highs_simd_level, array, count);
+    return;
+  }
+  for (HighsInt i = 0; i < count; i++)
+    if (std::fabs(array[i]) < kHighsTiny) array[i] = 0;
+}
+
+// Zero the values array[index[k]] that are less than kHighsTiny in
+// magnitude, removing their indices and returning the new count
+inline HighsInt tightIndexed(double* array, HighsInt* index,
+                             const HighsInt count) {
+  if (count >= kHighsSimdMinCount &&
+      highs_simd_level != HighsSimdLevel::kScalar)
+    return highsSimdTight(highs_simd_level, array, index, count);
+  HighsInt new_count = 0;
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iRow = index[k];
+    if (std::fabs(array[iRow]) >= kHighsTiny) {
+      index[new_count++] = iRow;
+    } else {
+      array[iRow] = 0;
+    }
+  }
+  return new_count;
+}
+
+#endif /* UTIL_HIGHSSIMD_H_ */